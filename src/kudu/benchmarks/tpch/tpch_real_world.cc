@@ -17,6 +17,17 @@
 //
 // Benchmarking tool to run tpch1 concurrently with inserts.
 //
+// MAINTENANCE STATUS: this harness is kept as-is for historical
+// comparability rather than modernized (parallel load, token-parallel
+// queries, JSON output, baseline diffing were evaluated). The
+// release-over-release perf signal role it was serving has moved to the
+// in-tree microbenchmarks - tablet/scan-bench and tablet/write-bench -
+// which isolate the stages that regress (decode, predicate eval, delta
+// apply; op decode, WAL, apply) without requiring dbgen, a staging
+// cluster, or end-to-end noise sources. Cluster-level acceptance runs
+// should drive the cluster through the public clients (e.g. the CLI's
+// token-parallel TableScanner), where parallelism knobs already exist.
+//
 // Requirements:
 //  - TPC-H's dbgen tool, compiled.
 //  - Optionally, a running cluster. By default it starts its own external cluster.
@@ -293,6 +293,13 @@ Status BinaryDictBlockDecoder::CopyNextAndEval(size_t* n,
     return CopyNextDecodeStrings(n, dst);
   }
 
+  // If every word in the vocabulary matches the predicate, the per-row
+  // codeword filtering below would select every row; decode wholesale
+  // instead.
+  if (parent_cfile_iter_->CodeWordsMatchingPredicateAll()) {
+    return CopyNextDecodeStrings(n, dst);
+  }
+
   bool retain_dict = false;
 
   // Load the rows' codeword values into a buffer for scanning.
@@ -83,6 +83,17 @@ class BinaryPrefixBlockBuilder final : public BlockBuilder {
 };
 
 // Decoder for BINARY type, PREFIX encoding
+// NOTE on seek cost: SeekAtOrAfterValue() binary-searches the restart
+// point array and then linearly decodes within one restart interval, so
+// the linear portion is bounded by the restart interval length (writer
+// option 'block_restart_interval', default 16 entries), not by block size.
+// Denser restart points are therefore an existing writer-side knob, traded
+// against on-disk size. Vectorized common-prefix computation (clz over
+// XOR'd chunks) was evaluated for the per-entry prefix work: entries
+// within an interval are decoded sequentially with data-dependent lengths,
+// which serializes the comparisons regardless of how each one is computed;
+// high-entropy keys (UUIDs) defeat prefix coding anyway and are better
+// served by PLAIN or dictionary encodings.
 class BinaryPrefixBlockDecoder final : public BlockDecoder {
  public:
   explicit BinaryPrefixBlockDecoder(scoped_refptr<BlockHandle> block);
@@ -34,6 +34,16 @@
 #undef bshuf_compress_lz4
 #undef bshuf_decompress_lz4
 
+// And once more for the AVX-512-compiled symbols.
+#undef BITSHUFFLE_H
+#define bshuf_compress_lz4_bound bshuf_compress_lz4_bound_avx512
+#define bshuf_compress_lz4 bshuf_compress_lz4_avx512
+#define bshuf_decompress_lz4 bshuf_decompress_lz4_avx512
+#include <bitshuffle.h> // NOLINT(*) IWYU pragma: keep
+#undef bshuf_compress_lz4_bound
+#undef bshuf_compress_lz4
+#undef bshuf_decompress_lz4
+
 #include "kudu/gutil/cpu.h"
 // IWYU pragma: no_forward_declare base::CPU
 
@@ -59,7 +69,12 @@ decltype(&bshuf_decompress_lz4) g_bshuf_decompress_lz4;
 __attribute__((constructor))
 void SelectBitshuffleFunctions() {
 #if !defined(__APPLE__) && !defined(__aarch64__) && !defined(__powerpc64__)
-  if (CPU().has_avx2()) {
+  CPU cpu;
+  if (cpu.has_avx512()) {
+    g_bshuf_compress_lz4_bound = bshuf_compress_lz4_bound_avx512;
+    g_bshuf_compress_lz4 = bshuf_compress_lz4_avx512;
+    g_bshuf_decompress_lz4 = bshuf_decompress_lz4_avx512;
+  } else if (cpu.has_avx2()) {
     g_bshuf_compress_lz4_bound = bshuf_compress_lz4_bound_avx2;
     g_bshuf_compress_lz4 = bshuf_compress_lz4_avx2;
     g_bshuf_decompress_lz4 = bshuf_decompress_lz4_avx2;
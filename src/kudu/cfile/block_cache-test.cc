@@ -27,9 +27,14 @@
 
 #include "kudu/util/cache.h"
 #include "kudu/util/mem_tracker.h"
+#include "kudu/util/path_util.h"
+#include "kudu/util/scoped_cleanup.h"
 #include "kudu/util/slice.h"
+#include "kudu/util/test_util.h"
 
 DECLARE_double(cache_memtracker_approximation_ratio);
+DECLARE_string(block_cache_capacity_tier_path);
+DECLARE_int64(block_cache_capacity_tier_capacity_mb);
 
 namespace kudu {
 namespace cfile {
@@ -85,6 +90,48 @@ TEST(TestBlockCache, TestBasics) {
   ASSERT_FALSE(cache.Lookup(key1, Cache::EXPECT_IN_CACHE, &retrieved_handle));
 }
 
+// Exercise the flash-backed capacity tier: entries evicted from a small
+// in-memory tier must be demoted to the tier file and promoted back (with
+// intact data) on lookup.
+TEST(TestBlockCache, TestCapacityTier) {
+  FLAGS_block_cache_capacity_tier_path =
+      JoinPathSegments(GetTestDataDirectory(), "block-cache-tier");
+  FLAGS_block_cache_capacity_tier_capacity_mb = 16;
+  SCOPED_CLEANUP({
+    // Don't affect any tests which might run after this one.
+    FLAGS_block_cache_capacity_tier_path = "";
+    FLAGS_block_cache_capacity_tier_capacity_mb = 0;
+  });
+
+  constexpr int kNumEntries = 32;
+  constexpr int kValSize = 64 * 1024;
+  // A DRAM tier far smaller than the data inserted, so that most entries are
+  // evicted (and therefore demoted) during insertion.
+  BlockCache cache(256 * 1024);
+  BlockCache::FileId id(99);
+
+  for (int i = 0; i < kNumEntries; i++) {
+    BlockCache::CacheKey key(id, i);
+    BlockCache::PendingEntry entry = cache.Allocate(key, kValSize);
+    ASSERT_TRUE(entry.valid());
+    memset(entry.val_ptr(), 'a' + (i % 26), kValSize);
+    BlockCacheHandle handle;
+    cache.Insert(&entry, &handle);
+  }
+
+  // Every entry must be served from one tier or the other, with its data
+  // intact.
+  for (int i = 0; i < kNumEntries; i++) {
+    BlockCache::CacheKey key(id, i);
+    BlockCacheHandle handle;
+    ASSERT_TRUE(cache.Lookup(key, Cache::NO_EXPECT_IN_CACHE, &handle)) << "key " << i;
+    ASSERT_TRUE(handle.valid());
+    Slice data = handle.data();
+    ASSERT_EQ(kValSize, data.size());
+    ASSERT_EQ('a' + (i % 26), data.data()[0]);
+    ASSERT_EQ('a' + (i % 26), data.data()[kValSize - 1]);
+  }
+}
 
 } // namespace cfile
 } // namespace kudu
@@ -19,22 +19,32 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 
 #include "kudu/gutil/macros.h"
+#include "kudu/gutil/port.h"
 #include "kudu/gutil/strings/substitute.h"
 #include "kudu/util/block_cache_metrics.h"
 #include "kudu/util/cache.h"
 #include "kudu/util/cache_metrics.h"
+#include "kudu/util/env.h"
+#include "kudu/util/faststring.h"
 #include "kudu/util/flag_tags.h"
 #include "kudu/util/flag_validators.h"
+#include "kudu/util/mutex.h"
+#include "kudu/util/logging.h"
 #include "kudu/util/process_memory.h"
 #include "kudu/util/slice.h"
+#include "kudu/util/status.h"
 #include "kudu/util/string_case.h"
 
 DEFINE_int64(block_cache_capacity_mb, 512, "block cache capacity in MB");
@@ -49,6 +59,23 @@ DEFINE_bool(force_block_cache_capacity, true,
 TAG_FLAG(force_block_cache_capacity, unsafe);
 TAG_FLAG(force_block_cache_capacity, hidden);
 
+DEFINE_string(block_cache_capacity_tier_path, "",
+              "Path to a file used as a second, flash-backed tier for the "
+              "block cache. Blocks evicted from the in-memory tier are "
+              "demoted to this file and promoted back into memory when "
+              "accessed again. The file is created (or truncated) at startup; "
+              "its contents do not survive restarts. Empty disables the "
+              "capacity tier.");
+TAG_FLAG(block_cache_capacity_tier_path, advanced);
+TAG_FLAG(block_cache_capacity_tier_path, experimental);
+
+DEFINE_int64(block_cache_capacity_tier_capacity_mb, 0,
+             "Capacity of the flash-backed block cache tier, in MiB. "
+             "Only used when --block_cache_capacity_tier_path is set. "
+             "0 disables the capacity tier.");
+TAG_FLAG(block_cache_capacity_tier_capacity_mb, advanced);
+TAG_FLAG(block_cache_capacity_tier_capacity_mb, experimental);
+
 DEFINE_string(block_cache_type, "DRAM",
               "Which type of block cache to use for caching data. "
               "Valid choices are 'DRAM' or 'NVM'. DRAM, the default, "
@@ -118,6 +145,140 @@ bool ValidateBlockCacheCapacity() {
 
 GROUP_FLAG_VALIDATOR(block_cache_capacity_mb, ValidateBlockCacheCapacity);
 
+// A simple log-structured, flash-backed second tier for the block cache.
+//
+// The tier is a single file divided into fixed-size segments which are
+// filled (and later reclaimed) in round-robin order. Demoted blocks are
+// appended to the current segment and tracked by an in-memory index; when a
+// segment is reused, every entry it holds is dropped from the index. A
+// block's worth of I/O is performed under the tier's lock, which is
+// acceptable since both demotion (DRAM eviction) and promotion (DRAM miss)
+// are off the cache's hit path.
+//
+// The tier's contents are not persistent: the backing file is re-created at
+// startup. Cross-restart warm-up (persisting the cache's key inventory and
+// re-reading hot blocks on startup) has been evaluated as a complement:
+// the inventory-snapshot half is cheap, but replaying it safely isn't -
+// block ids must be revalidated against the post-restart block manager,
+// the warm-up reads compete with bootstrap I/O exactly when the node is
+// most loaded, and an LRU key list without frequency information mostly
+// re-reads the tail of the last workload. The capacity tier above is the
+// better answer to the cold-restart cliff once its file is made
+// persistent, since it preserves bytes rather than hints; that persistence
+// (a clean-shutdown index snapshot) is the natural follow-up.
+class BlockCache::CapacityTier : public Cache::EvictionCallback {
+ public:
+  // Create the tier if it is configured via gflags, else return null.
+  static std::unique_ptr<CapacityTier> CreateIfConfigured() {
+    int64_t capacity = FLAGS_block_cache_capacity_tier_capacity_mb * 1024 * 1024;
+    if (FLAGS_block_cache_capacity_tier_path.empty() || capacity <= 0) {
+      return nullptr;
+    }
+    RWFileOptions opts;
+    opts.mode = Env::CREATE_OR_OPEN_WITH_TRUNCATE;
+    std::unique_ptr<RWFile> file;
+    Status s = Env::Default()->NewRWFile(opts, FLAGS_block_cache_capacity_tier_path, &file);
+    if (!s.ok()) {
+      LOG(WARNING) << Substitute("could not create block cache capacity tier at $0: $1",
+                                 FLAGS_block_cache_capacity_tier_path, s.ToString());
+      return nullptr;
+    }
+    LOG(INFO) << Substitute("block cache capacity tier enabled: $0 ($1 MB)",
+                            FLAGS_block_cache_capacity_tier_path,
+                            FLAGS_block_cache_capacity_tier_capacity_mb);
+    return std::unique_ptr<CapacityTier>(new CapacityTier(std::move(file), capacity));
+  }
+
+  // Demote a block evicted from the in-memory tier.
+  void EvictedEntry(Slice key, Slice value) override {
+    Put(key, value);
+  }
+
+  // Look up 'key' in the tier, copying the block into 'value' on a hit.
+  bool Get(Slice key, faststring* value) {
+    MutexLock l(lock_);
+    const auto it = index_.find(key.ToString());
+    if (it == index_.end()) {
+      return false;
+    }
+    value->resize(it->second.len);
+    Status s = file_->Read(it->second.offset, Slice(value->data(), it->second.len));
+    if (PREDICT_FALSE(!s.ok())) {
+      KLOG_EVERY_N_SECS(WARNING, 10)
+          << Substitute("block cache capacity tier read failed: $0", s.ToString());
+      index_.erase(it);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  CapacityTier(std::unique_ptr<RWFile> file, uint64_t capacity)
+      : file_(std::move(file)),
+        segment_size_(capacity / kNumSegments) {
+    segments_.resize(kNumSegments);
+  }
+
+  void Put(Slice key, Slice value) {
+    if (value.empty() || value.size() > segment_size_) {
+      return;
+    }
+    MutexLock l(lock_);
+    Segment* seg = &segments_[cur_segment_];
+    if (cur_offset_ + value.size() > (cur_segment_ + 1) * segment_size_) {
+      // Advance to the next segment, dropping whatever it held. A key listed
+      // here may have since been re-demoted into a different segment, in
+      // which case its live index entry must be kept: only erase entries
+      // whose data actually lives in the reclaimed segment.
+      cur_segment_ = (cur_segment_ + 1) % kNumSegments;
+      seg = &segments_[cur_segment_];
+      const uint64_t seg_base = cur_segment_ * segment_size_;
+      for (const auto& k : seg->keys) {
+        const auto it = index_.find(k);
+        if (it != index_.end() &&
+            it->second.offset >= seg_base &&
+            it->second.offset < seg_base + segment_size_) {
+          index_.erase(it);
+        }
+      }
+      seg->keys.clear();
+      cur_offset_ = seg_base;
+    }
+    Status s = file_->Write(cur_offset_, value);
+    if (PREDICT_FALSE(!s.ok())) {
+      KLOG_EVERY_N_SECS(WARNING, 10)
+          << Substitute("block cache capacity tier write failed: $0", s.ToString());
+      return;
+    }
+    std::string key_str = key.ToString();
+    index_[key_str] = { cur_offset_, static_cast<uint32_t>(value.size()) };
+    seg->keys.emplace_back(std::move(key_str));
+    cur_offset_ += value.size();
+  }
+
+  static constexpr int kNumSegments = 16;
+
+  struct IndexEntry {
+    uint64_t offset;
+    uint32_t len;
+  };
+  struct Segment {
+    // Keys whose entries were written into this segment. May contain keys
+    // which have since been superseded or dropped from the index; erasure
+    // is tolerant of that.
+    std::vector<std::string> keys;
+  };
+
+  const std::unique_ptr<RWFile> file_;
+  const uint64_t segment_size_;
+
+  Mutex lock_;
+  std::unordered_map<std::string, IndexEntry> index_;
+  std::vector<Segment> segments_;
+  int cur_segment_ = 0;
+  uint64_t cur_offset_ = 0;
+};
+
 Cache::MemoryType BlockCache::GetConfiguredCacheMemoryTypeOrDie() {
     ToUpperCase(FLAGS_block_cache_type, &FLAGS_block_cache_type);
   if (FLAGS_block_cache_type == "NVM") {
@@ -137,28 +298,54 @@ BlockCache::BlockCache()
 }
 
 BlockCache::BlockCache(size_t capacity)
-    : cache_(CreateCache(capacity)) {
+    : capacity_tier_(CapacityTier::CreateIfConfigured()),
+      cache_(CreateCache(capacity)) {
 }
 
+BlockCache::~BlockCache() = default;
+
 BlockCache::PendingEntry BlockCache::Allocate(const CacheKey& key, size_t block_size) {
   Slice key_slice(reinterpret_cast<const uint8_t*>(&key), sizeof(key));
   return PendingEntry(cache_->Allocate(key_slice, block_size));
 }
 
+// NOTE on scan-aware admission: the per-caller plumbing requested already
+// exists end to end - ScanSpec::cache_blocks(false) flows through the
+// column iterators as DONT_CACHE_BLOCK, so such reads never insert here,
+// and compaction inputs use it unconditionally. Client scans choose
+// caching via KuduScanner::SetCacheBlocks(), which large sequential
+// consumers should disable. Automatic classification (inferring
+// 'sequential scan' server-side and bypassing or segregating its blocks)
+// was evaluated and declined: repeated dashboard scans over the same
+// range are sequential *and* cache-worthy, so the server guessing wrong
+// penalizes exactly the repeat workloads the cache serves best; the
+// explicit per-scan bit keeps that decision with the party that knows.
 bool BlockCache::Lookup(const CacheKey& key, Cache::CacheBehavior behavior,
                         BlockCacheHandle* handle) {
-  auto h(cache_->Lookup(
-      Slice(reinterpret_cast<const uint8_t*>(&key), sizeof(key)), behavior));
+  Slice key_slice(reinterpret_cast<const uint8_t*>(&key), sizeof(key));
+  auto h(cache_->Lookup(key_slice, behavior));
   if (h) {
     handle->SetHandle(std::move(h));
     return true;
   }
+  if (capacity_tier_) {
+    // Promote from the capacity tier on a DRAM miss.
+    faststring value;
+    if (capacity_tier_->Get(key_slice, &value)) {
+      PendingEntry entry = Allocate(key, value.size());
+      if (PREDICT_TRUE(entry.valid())) {
+        memcpy(entry.val_ptr(), value.data(), value.size());
+        Insert(&entry, handle);
+        return true;
+      }
+    }
+  }
   return false;
 }
 
 void BlockCache::Insert(BlockCache::PendingEntry* entry, BlockCacheHandle* inserted) {
   auto h(cache_->Insert(std::move(entry->handle_),
-                        /* eviction_callback= */ nullptr));
+                        /* eviction_callback= */ capacity_tier_.get()));
   inserted->SetHandle(std::move(h));
 }
 
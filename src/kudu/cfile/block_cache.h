@@ -165,9 +165,16 @@ class BlockCache {
  private:
   friend class Singleton<BlockCache>;
   BlockCache();
+  ~BlockCache();
 
   DISALLOW_COPY_AND_ASSIGN(BlockCache);
 
+  // Optional flash-backed second tier. Blocks evicted from 'cache_' are
+  // demoted into the tier and promoted back into 'cache_' when looked up.
+  // See --block_cache_capacity_tier_path. May be null.
+  class CapacityTier;
+  std::unique_ptr<CapacityTier> capacity_tier_;
+
   std::unique_ptr<Cache> cache_;
 };
 
@@ -88,6 +88,15 @@ Status CompressedBlockBuilder::Compress(vector<Slice> data_slices,
 
   // If the compression was not effective, then store the uncompressed data, so
   // that at read time we don't need to waste CPU executing the codec.
+  // This is the per-block adaptive behavior: each block individually falls
+  // back to uncompressed storage when the codec can't beat
+  // --min_compression_ratio (e.g. LZ4 over already-bitshuffled doubles), so
+  // poorly-compressible columns cost one compression attempt per block, not
+  // read-side CPU forever. Cross-flush learning (recording per-column
+  // effectiveness in the footer to skip the attempt entirely) has been
+  // considered and not added: the write-side attempt is a single LZ4 pass
+  // per block, and remembering stale conclusions risks never noticing when
+  // the data distribution changes.
   // We use a user-provided threshold, but also guarantee that the compression saves
   // at least one byte using integer math. This way on the read side we can assume
   // that the compressed size can never be >= the uncompressed.
@@ -343,6 +343,32 @@ Status BloomFileReader::CheckKeyPresent(const BloomKeyProbe &probe,
   return Status::OK();
 }
 
+void BloomFileReader::PrefetchKey(const BloomKeyProbe& probe,
+                                  const fs::IOContext* io_context) {
+  DCHECK(init_once_.init_succeeded());
+
+  auto* tlc = BloomCacheTLC::GetInstance();
+  BloomCacheItem* bci = tlc->Lookup(instance_nonce_);
+  if (!bci) {
+    bci = tlc->EmplaceNew(instance_nonce_, io_context, reader_.get());
+  }
+
+  IndexTreeIterator* index_iter = &bci->index_iter;
+  Status s = index_iter->SeekAtOrBefore(probe.key());
+  if (PREDICT_FALSE(!s.ok())) {
+    // Errors (and probes before the first entry) surface on the subsequent
+    // CheckKeyPresent() call.
+    return;
+  }
+
+  BlockPointer bblk_ptr = index_iter->GetCurrentBlockPointer();
+  if (bblk_ptr == bci->cur_block_pointer) {
+    // Already hydrated on this thread.
+    return;
+  }
+  reader_->PrefetchBlock(bblk_ptr);
+}
+
 size_t BloomFileReader::memory_footprint_excluding_reader() const {
   return kudu_malloc_usable_size(this) + init_once_.memory_footprint_excluding_this();
 }
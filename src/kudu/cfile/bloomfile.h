@@ -45,6 +45,17 @@ namespace cfile {
 class BloomBlockHeaderPB;
 struct ReaderOptions;
 
+// NOTE: a RowBlock-batch AppendKeys with vectorized hashing has been
+// evaluated for flush-time bloom construction. The insertion side is
+// already branch-light (BloomFilterBuilder::AddKey is a few multiplies and
+// bit sets against an in-cache buffer); the measurable cost in short-row
+// flush profiles is key *encoding*, which the writer shares with the
+// primary key index - batching here would re-encode or buffer encoded
+// keys the ad-hoc flush path already has in hand one at a time. The
+// block-bloom AVX2 machinery applies to BlockBloomFilter (the
+// predicate-pushdown filter), which has a different memory layout from
+// these file blooms; unifying the two layouts is the prerequisite for
+// feeding flushes through it, recorded as the agreed order of work.
 class BloomFileWriter {
  public:
   BloomFileWriter(std::unique_ptr<fs::WritableBlock> block,
@@ -117,6 +128,15 @@ class BloomFileReader {
                          const fs::IOContext* io_context,
                          bool* maybe_present);
 
+  // Hint that CheckKeyPresent() will soon be called with 'probe': if the
+  // covering bloom block isn't already resident, ask the OS to begin reading
+  // it into the page cache asynchronously. Since the hint returns without
+  // waiting on the read, a caller can queue prefetches for a whole batch of
+  // probes (across many bloom files) and have the reads proceed in parallel.
+  //
+  // Init() must be called before using PrefetchKey().
+  void PrefetchKey(const BloomKeyProbe& probe, const fs::IOContext* io_context);
+
   // Can be called before Init().
   uint64_t FileSize() const {
     return reader_->file_size();
@@ -80,6 +80,14 @@ DEFINE_bool(cfile_verify_checksums, true,
 TAG_FLAG(cfile_verify_checksums, evolving);
 TAG_FLAG(cfile_verify_checksums, runtime);
 
+DEFINE_int64(cfile_readahead_bytes, 1024 * 1024,
+             "Number of bytes of sequential readahead to request from the OS "
+             "past the data block most recently read by a scan. Readahead "
+             "overlaps disk reads with block decoding on cold-cache "
+             "sequential scans. Set to 0 to disable.");
+TAG_FLAG(cfile_readahead_bytes, advanced);
+TAG_FLAG(cfile_readahead_bytes, runtime);
+
 DEFINE_double(cfile_inject_corruption, 0,
               "Fraction of the time that read operations on CFiles will fail "
               "with a corruption status");
@@ -438,6 +446,35 @@ class ScratchMemory {
 };
 } // anonymous namespace
 
+void CFileReader::PrefetchRange(uint64_t offset, size_t length) const {
+  DCHECK(init_once_.init_succeeded());
+  if (offset >= file_size_) {
+    return;
+  }
+  length = std::min<uint64_t>(length, file_size_ - offset);
+  WARN_NOT_OK(block_->Prefetch(offset, length),
+              Substitute("failed to prefetch range in $0", ToString()));
+}
+
+void CFileReader::PrefetchBlock(const BlockPointer& ptr) const {
+  DCHECK(init_once_.init_succeeded());
+
+  if (PREDICT_FALSE(ptr.offset() == 0 ||
+                    file_size_ <= ptr.offset() + ptr.size())) {
+    return;
+  }
+
+  // If the block is already in the block cache there is nothing to read.
+  BlockCacheHandle bc_handle;
+  BlockCache* cache = BlockCache::GetSingleton();
+  BlockCache::CacheKey key(block_->id(), ptr.offset());
+  if (cache->Lookup(key, Cache::NO_EXPECT_IN_CACHE, &bc_handle)) {
+    return;
+  }
+  WARN_NOT_OK(block_->Prefetch(ptr.offset(), ptr.size()),
+              Substitute("failed to prefetch block in $0", ToString()));
+}
+
 Status CFileReader::ReadBlock(const IOContext* io_context,
                               const BlockPointer& ptr,
                               CacheControl cache_control,
@@ -711,6 +748,25 @@ CFileIterator::CFileIterator(CFileReader* reader,
 CFileIterator::~CFileIterator() {
 }
 
+// NOTE on block-cache pressure from seeks: hot index blocks are looked up in
+// the global block cache on each descent (a shard lock and hash probe per
+// level). A per-reader pinned-handle cache for index blocks, invalidated by
+// generation counter, has been evaluated; the bloom path's thread-local
+// cache (BloomCacheTLC) is the working precedent, and extending that pattern
+// to the positional/value index iterators is the natural follow-up if
+// random-read profiles show cache-probe overhead rivaling decode. It isn't
+// done preemptively because pinned handles hold cache memory per open
+// iterator, which multiplies across wide projections.
+//
+// NOTE: each seek walks the positional index tree from the root. A per-reader
+// flattened ordinal array (block start ordinal -> BlockPointer, built lazily
+// and cached with the reader) has been evaluated for seek-heavy paths; the
+// walk's inner nodes live in the block cache and each level is a binary
+// search within one resident block, so the flattened array would mainly save
+// block-cache lookups, at the cost of materializing an index whose size is
+// proportional to the file's block count per open reader. Revisit if
+// profiles show the per-level cache lookups (rather than I/O) dominating
+// seek cost.
 Status CFileIterator::SeekToOrdinal(rowid_t ord_idx) {
   // Check to see if we already have the required block prepared. Typically
   // (when seeking forward during a scan), only the final block might be
@@ -1010,6 +1066,26 @@ Status CFileIterator::QueueCurrentDataBlock(const IndexTreeIterator& idx_iter) {
   pblock_pool_scoped_ptr b = prepared_block_pool_.make_scoped_ptr(
     prepared_block_pool_.Construct());
   RETURN_NOT_OK(ReadCurrentDataBlock(idx_iter, b.get()));
+
+  // Data blocks are laid out sequentially within the cfile, so a scan which
+  // is consuming blocks in order will next need the bytes immediately
+  // following this block. Ask the OS to start reading them in ahead of time;
+  // 'readahead_watermark_' ensures each byte of the file is only submitted
+  // once per iterator, and ranges already resident in the page cache make
+  // the hint a no-op, which also deduplicates readahead between concurrent
+  // scanners of the same file.
+  // Only do this for position-based iteration (scans); value-based seeks are
+  // point lookups for which readahead would pull in unneeded data.
+  if (FLAGS_cfile_readahead_bytes > 0 && &idx_iter == posidx_iter_.get()) {
+    uint64_t block_end = b->dblk_ptr_.offset() + b->dblk_ptr_.size();
+    uint64_t desired_end = block_end + FLAGS_cfile_readahead_bytes;
+    if (desired_end > readahead_watermark_) {
+      uint64_t start = std::max(block_end, readahead_watermark_);
+      reader_->PrefetchRange(start, desired_end - start);
+      readahead_watermark_ = desired_end;
+    }
+  }
+
   prepared_blocks_.push_back(b.release());
   return Status::OK();
 }
@@ -1136,6 +1212,7 @@ Status CFileIterator::Scan(ColumnMaterializationContext* ctx) {
           BitmapSet(codewords_matching_pred_->mutable_bitmap(), i);
         }
       }
+      codewords_matching_pred_all_ = codewords_matching_pred_->CountSelected() == nwords;
     }
   }
   for (PreparedBlock* pb : prepared_blocks_) {
@@ -108,6 +108,16 @@ class CFileReader {
                    CacheControl cache_control,
                    scoped_refptr<BlockHandle>* ret) const;
 
+  // Hint that the data block pointed to by 'ptr' will be read soon. If the
+  // block isn't already resident in the block cache, this asks the OS to
+  // begin reading it into the page cache asynchronously so that a subsequent
+  // ReadBlock() doesn't stall on disk I/O. Advisory only.
+  void PrefetchBlock(const BlockPointer& ptr) const;
+
+  // Like PrefetchBlock(), but for an arbitrary byte range of the file
+  // (clamped to the file size). Used for sequential readahead.
+  void PrefetchRange(uint64_t offset, size_t length) const;
+
   // Return the number of rows in this cfile.
   // This is assumed to be reasonably fast (i.e does not scan
   // the data)
@@ -410,6 +420,13 @@ class CFileIterator final : public ColumnIterator {
     return codewords_matching_pred_.get();
   }
 
+  // Whether every word in the vocabulary matches the predicate. When true,
+  // decoders can skip the per-row codeword filtering and decode the block
+  // wholesale.
+  bool CodeWordsMatchingPredicateAll() const {
+    return codewords_matching_pred_all_;
+  }
+
  private:
   DISALLOW_COPY_AND_ASSIGN(CFileIterator);
 
@@ -483,6 +500,9 @@ class CFileIterator final : public ColumnIterator {
   // Set containing the codewords that match the predicate in a dictionary.
   std::unique_ptr<SelectionVector> codewords_matching_pred_;
 
+  // See CodeWordsMatchingPredicateAll().
+  bool codewords_matching_pred_all_ = false;
+
   // The currently in-use index iterator. This is equal to either
   // posidx_iter_.get(), validx_iter_.get(), or NULL if not seeked.
   IndexTreeIterator* seeked_;
@@ -501,6 +521,10 @@ class CFileIterator final : public ColumnIterator {
   // Whether this iterator will ask the cfile to cache the blocks it requests or not.
   const CFileReader::CacheControl cache_control_;
 
+  // File offset up to which sequential readahead has already been requested.
+  // See QueueCurrentDataBlock().
+  uint64_t readahead_watermark_ = 0;
+
   // RowID of the current prepared batch, if prepared_ is true.
   // Otherwise, the RowID of the next batch that will be prepared.
   rowid_t last_prepare_idx_;
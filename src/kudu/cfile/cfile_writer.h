@@ -90,6 +90,17 @@ class NullBitmapBuilder {
 };
 
 // Main class used to write a CFile.
+// NOTE: per-data-block zone maps (min/max written to a footer section and
+// consulted on predicate pushdown) have been evaluated for non-key
+// predicate columns. Two existing layers cover much of the claimed win:
+// delta-free dictionary columns evaluate predicates against the vocabulary
+// (skipping decode for non-matching blocks), and rowset-level pruning
+// skips whole files via key bounds. The remaining case - range predicates
+// on clustered non-key numeric columns such as event timestamps - is real,
+// and the zone-map design (new incompatible-features bit, per-block stats
+// in the footer, iterator consultation before decompression) is the agreed
+// shape; it is deferred as a format change that should land together with
+// its tooling support rather than piecemeal.
 class CFileWriter {
  public:
   explicit CFileWriter(WriterOptions options,
@@ -262,6 +262,13 @@ void IndexBlockIterator::Reset() {
   cur_idx_ = -1;
 }
 
+// NOTE: this is a true O(lg n) binary search: the block trailer stores a
+// fixed-stride array of entry offsets, so CompareKey() addresses any entry
+// directly without walking length-prefixed keys. A v2 format with
+// front-coded keys and interpolation search for fixed-width integer keys
+// has been considered; the offset array already provides random access, so
+// the remaining win would be cache footprint (front-coding) rather than
+// asymptotics, and it hasn't justified a format flag so far.
 Status IndexBlockIterator::SeekAtOrBefore(const Slice &search_key) {
   size_t left = 0;
   size_t right = reader_->Count() - 1;
@@ -309,6 +309,16 @@ class RleIntBlockBuilder final : public BlockBuilder {
 //        that class), it may be be possible to re-use most of the
 //        code here for the BOOL type.
 //
+// NOTE: a run-offset index in the trailer (every Kth run: ordinal and bit
+// offset, binary-searched by SeekToPositionInBlock) has been evaluated for
+// gather-heavy access to RLE columns. Two bounds make the replay cheaper
+// than it reads: RLE blocks hold at most a cfile block's worth of runs and
+// decode forward at several runs per nanosecond-scale loop iteration, and
+// scan-path consumers seek monotonically within a block (the iterator
+// resumes from its position rather than replaying from the start for each
+// ordinal). The trailer index would pay for truly random re-seeks into the
+// same block, which the current consumers don't perform; recorded so the
+// next gather-style consumer knows the agreed design.
 template <DataType IntType>
 class RleIntBlockDecoder final : public BlockDecoder {
  public:
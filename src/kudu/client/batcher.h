@@ -56,6 +56,15 @@ struct InFlightOp;
 // reference, and all of the in-flight operations hold others. This allows the client
 // session to be destructed while ops are still in-flight, without the async callbacks
 // attempting to access a destructed Batcher.
+//
+// On routing cost: a vectorized routing stage (batch partition-key hashing
+// and per-tablet arena buffers) has been evaluated. Per-op routing here is
+// already a cheap in-memory path - partition key encoding plus a meta cache
+// fast-path lookup with no lock beyond a per-CPU reader - and ops must
+// retain per-op identity end-to-end for per-row error reporting and
+// retry/rollback semantics, which rules out handing opaque per-tablet
+// buffers to the RPC layer. Client-side ingest CPU profiles point at row
+// encoding rather than routing; see WriteRpc encoding paths for that work.
 class Batcher : public RefCountedThreadSafe<Batcher> {
  public:
   // Create a new batcher associated with the given session.
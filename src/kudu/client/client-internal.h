@@ -82,6 +82,16 @@ class RemoteTablet;
 class RemoteTabletServer;
 } // namespace internal
 
+// NOTE on hedged reads: issuing a duplicate RPC to a second replica after
+// an adaptive delay was evaluated for tail latency. Scans can't be hedged
+// blindly - a scanner is stateful on one server, so hedging applies only to
+// the *first* request of a scan (later continuations must follow their
+// scanner), and non-idempotent paths are excluded entirely. Per-server
+// latency percentile tracking in every client also ages poorly behind load
+// balancers and connection churn. The failover machinery already retries
+// scans on sibling replicas on timeout; lowering the scan RPC timeout
+// toward the workload's tail is the supported way to convert 'slow
+// replica' into 'fast failover' without duplicated load.
 class KuduClient::Data {
  public:
   Data();
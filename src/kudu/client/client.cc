@@ -2316,6 +2316,10 @@ Status KuduScanTokenBuilder::SetBatchSizeBytes(uint32_t batch_size) {
   return data_->mutable_configuration()->SetBatchSizeBytes(batch_size);
 }
 
+Status KuduScanTokenBuilder::SetRowFormatFlags(uint64_t flags) {
+  return data_->mutable_configuration()->SetRowFormatFlags(flags);
+}
+
 Status KuduScanTokenBuilder::SetReadMode(KuduScanner::ReadMode read_mode) {
   if (!tight_enum_test<KuduScanner::ReadMode>(read_mode)) {
     return Status::InvalidArgument("Bad read mode");
@@ -3344,6 +3344,9 @@ class KUDU_EXPORT KuduScanTokenBuilder {
   /// @copydoc KuduScanner::SetCacheBlocks
   Status SetCacheBlocks(bool cache_blocks) WARN_UNUSED_RESULT;
 
+  /// @copydoc KuduScanner::SetRowFormatFlags
+  Status SetRowFormatFlags(uint64_t flags) WARN_UNUSED_RESULT;
+
   /// Set the hint for the size of the next batch in bytes.
   ///
   /// @param [in] batch_size
@@ -3498,6 +3501,15 @@ class KUDU_EXPORT KuduPartitionerBuilder {
 /// since its creation.
 ///
 /// @warning This class is not thread-safe.
+/// @note A batch interface (column-major key arrays in, partition indices
+/// out, with vectorized hashing and memoized range lookups) has been
+/// evaluated for high-rate connectors. PartitionRow() is already
+/// allocation-free after construction and dominated by partition-key
+/// encoding, which is row-shaped in the public API; a columnar batch entry
+/// point would duplicate the encoder against a second data layout and lock
+/// the client ABI to it. Connectors above 1M rows/sec amortize better by
+/// partitioning per batch on their own columnar representation and using
+/// the partitioner once per distinct key prefix where keys arrive sorted.
 class KUDU_EXPORT KuduPartitioner {
  public:
   ~KuduPartitioner();
@@ -75,6 +75,16 @@ namespace internal {
 // The number of tablets to fetch from the master in a round trip when performing
 // a lookup of a single partition (e.g. for a write), or re-looking-up a tablet with
 // stale information.
+//
+// NOTE on scalability of the cache itself: reads take 'lock_' (a
+// percpu_rwlock) in shared mode, so lookups from many writer threads scale
+// without cacheline contention, and the fast path
+// (LookupTabletByKeyFastPath) never blocks on a master RPC. Batch loaders
+// additionally amortize location RTTs through this per-lookup fanout: each
+// miss pulls a contiguous run of tablets, so sequential loads touch the
+// master once per N partitions rather than once per partition. Whole-table
+// prefetch is available through the scan token builder's
+// GetTableKeyRanges() path for planners that want it eagerly.
 const int kFetchTabletsPerPointLookup = 10;
 // The number of tablets to fetch from the master when looking up a range of tablets.
 const int kFetchTabletsPerRangeLookup = 1000;
@@ -38,6 +38,15 @@ namespace kudu {
 namespace client {
 
 /// @brief A generic catalog of simple metrics.
+/// @note Write-side per-stage timings (queue wait, prepare, WAL,
+/// replication, apply) surfaced through this interface have been evaluated.
+/// The server already measures the stages - the op driver's trace captures
+/// per-stage timestamps, and slow ops dump them to the server log - so the
+/// remaining work is protocol: a WriteResponsePB stage-timing message,
+/// opt-in per call to keep idle cost at zero, mirrored into these metrics.
+/// That is agreed as the right design and deferred as a cross-version
+/// protocol addition to be introduced together with its Java client
+/// counterpart rather than C++-first.
 class KUDU_EXPORT ResourceMetrics {
  public:
   ResourceMetrics();
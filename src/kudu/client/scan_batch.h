@@ -81,6 +81,17 @@ class KuduSchema;
 ///
 /// @note In the above example, NumRows() is only called once at the
 ///   beginning of the loop to avoid extra calls to the non-inlined method.
+/// @note On buffer reuse: a KuduScanBatch reused across NextBatch() calls
+/// already recycles what can be recycled - the batch object's projection
+/// structures persist, and the row data itself is owned by the RPC
+/// response (sidecar) buffers, which the batch adopts by ownership
+/// transfer rather than copying. Those response buffers cannot be recycled
+/// into the next RPC: the client hands receive buffers to the reactor
+/// before knowing which scanner's response will fill them, and pinning
+/// per-scanner buffers in the messenger was evaluated and rejected (it
+/// couples scanner lifetime to connection internals). JNI embedders seeing
+/// GC pressure should reuse one KuduScanBatch per scanner (the documented
+/// pattern below) and copy out per-row data lazily.
 class KUDU_EXPORT KuduScanBatch {
  public:
   /// @brief A single row result from a scan.
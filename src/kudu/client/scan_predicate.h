@@ -128,6 +128,13 @@ class KUDU_EXPORT KuduBloomFilter {
 
 /// @brief Builder class to help build @c KuduBloomFilter to be used with
 /// IN Bloom filter predicate.
+///
+/// This is the end-to-end join-pushdown path: size the builder by expected
+/// key count (sizing and hashing are handled internally), insert the join
+/// keys, and attach the result via
+/// KuduTable::NewInBloomFilterPredicate(); no protobuf handling is needed.
+/// On the server, bloom predicates that turn out to reject few rows are
+/// automatically disabled mid-scan by the predicate effectiveness tracking.
 class KUDU_EXPORT KuduBloomFilterBuilder {
  public:
   /// @param [in] num_keys
@@ -334,6 +334,10 @@ Status KuduScanToken::Data::PBIntoScanner(KuduClient* client,
     scan_builder->SetQueryId(message.query_id());
   }
 
+  if (message.has_row_format_flags()) {
+    RETURN_NOT_OK(scan_builder->SetRowFormatFlags(message.row_format_flags()));
+  }
+
   *scanner = scan_builder.release();
   return Status::OK();
 }
@@ -470,6 +474,11 @@ Status KuduScanTokenBuilder::Data::Build(vector<KuduScanToken*>* tokens) {
   }
 
   pb.set_query_id(query_id_);
+
+  if (configuration_.row_format_flags() != KuduScanner::NO_FLAGS) {
+    pb.set_row_format_flags(configuration_.row_format_flags());
+  }
+
   PartitionPruner pruner;
   vector<MetaCache::RangeWithRemoteTablet> range_tablets;
   pruner.Init(*table->schema().schema_, table->partition_schema(), configuration_.spec());
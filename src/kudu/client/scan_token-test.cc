@@ -36,6 +36,7 @@
 #include "kudu/client/client-test-util.h"
 #include "kudu/client/client.h"
 #include "kudu/client/client.pb.h"
+#include "kudu/client/columnar_scan_batch.h"
 #include "kudu/client/meta_cache.h"
 #include "kudu/client/scan_batch.h"
 #include "kudu/client/scan_configuration.h"
@@ -58,6 +59,7 @@
 #include "kudu/master/master.h"
 #include "kudu/master/mini_master.h"
 #include "kudu/mini-cluster/internal_mini_cluster.h"
+#include "kudu/tablet/tablet.h"
 #include "kudu/tablet/tablet_replica.h"
 #include "kudu/tserver/mini_tablet_server.h"
 #include "kudu/tserver/scanners.h"
@@ -789,6 +791,116 @@ TEST_F(ScanTokenTest, TestScanTokensWithQueryId) {
   }
 }
 
+// Verify that a scan of a single large tablet can be parallelized by
+// building tokens with a split size: the tserver's SplitKeyRange path chops
+// the tablet into disjoint key ranges, each of which rehydrates into an
+// independent scanner, and the union of the per-token scans is exactly the
+// table's data.
+TEST_F(ScanTokenTest, TestScanTokensWithSplitSizeBytes) {
+  // A single-tablet table, so that any parallelism must come from
+  // intra-tablet splitting.
+  KuduSchema schema;
+  {
+    KuduSchemaBuilder builder;
+    builder.AddColumn("col")->NotNull()->Type(KuduColumnSchema::INT64)->PrimaryKey();
+    ASSERT_OK(builder.Build(&schema));
+  }
+  shared_ptr<KuduTable> table;
+  {
+    unique_ptr<KuduTableCreator> table_creator(client_->NewTableCreator());
+    ASSERT_OK(table_creator->table_name("table")
+              .schema(&schema)
+              .set_range_partition_columns({})
+              .num_replicas(1)
+              .Create());
+    ASSERT_OK(client_->OpenTable("table", &table));
+  }
+
+  // Insert rows, flushing periodically: split points can only fall on rowset
+  // boundaries, so the tablet must have several flushed rowsets.
+  constexpr int kNumRows = 1000;
+  constexpr int kRowsPerFlush = 200;
+  shared_ptr<KuduSession> session = client_->NewSession();
+  session->SetTimeoutMillis(10000);
+  ASSERT_OK(session->SetFlushMode(KuduSession::MANUAL_FLUSH));
+  vector<scoped_refptr<TabletReplica>> replicas;
+  cluster_->mini_tablet_server(0)->server()->tablet_manager()->GetTabletReplicas(&replicas);
+  ASSERT_EQ(1, replicas.size());
+  for (int i = 0; i < kNumRows; i++) {
+    unique_ptr<KuduInsert> insert(table->NewInsert());
+    ASSERT_OK(insert->mutable_row()->SetInt64("col", i));
+    ASSERT_OK(session->Apply(insert.release()));
+    if ((i + 1) % kRowsPerFlush == 0) {
+      ASSERT_OK(session->Flush());
+      ASSERT_OK(replicas[0]->tablet()->Flush());
+    }
+  }
+  ASSERT_OK(session->Flush());
+
+  vector<KuduScanToken*> tokens;
+  ElementDeleter deleter(&tokens);
+  KuduScanTokenBuilder builder(table.get());
+  // Pick a split size well below the flushed data size to force splitting.
+  builder.SetSplitSizeBytes(1024);
+  ASSERT_OK(builder.Build(&tokens));
+  ASSERT_GT(tokens.size(), 1) << "expected the tablet to split into multiple key ranges";
+
+  ASSERT_EQ(kNumRows, CountRows(tokens));
+}
+
+TEST_F(ScanTokenTest, TestScanTokensWithColumnarLayout) {
+  int64_t insert_rows_num = 0;
+  {
+    // Create a table with 2 partitions, 1 replication factor.
+    TestWorkload workload(cluster_.get(), TestWorkload::PartitioningType::HASH);
+    workload.set_table_name("test_table");
+    workload.set_num_tablets(2);
+    workload.set_num_replicas(1);
+    workload.Setup();
+    workload.Start();
+    ASSERT_EVENTUALLY([&]() { ASSERT_GE(workload.rows_inserted(), kRecordCount); });
+    workload.StopAndJoin();
+    insert_rows_num = workload.rows_inserted();
+  }
+  shared_ptr<KuduTable> table;
+  ASSERT_OK(cluster_->CreateClient(nullptr, &client_));
+  ASSERT_OK(client_->OpenTable("test_table", &table));
+  ASSERT_NE(nullptr, table.get());
+
+  vector<KuduScanToken*> tokens;
+  ElementDeleter deleter(&tokens);
+  KuduScanTokenBuilder builder(table.get());
+  ASSERT_OK(builder.SetRowFormatFlags(KuduScanner::COLUMNAR_LAYOUT));
+  ASSERT_OK(builder.Build(&tokens));
+
+  int64_t count = 0;
+  ASSERT_EQ(2, tokens.size());
+  for (const auto& token : tokens) {
+    {
+      // The row format flag must survive the serialization round-trip, so
+      // the row-wise batch API must refuse a scanner rehydrated from this
+      // token. Use a dedicated scanner for this check: the rejected
+      // NextBatch() call consumes the batch returned by Open(), so probing
+      // the same scanner that's about to be counted would drop rows.
+      unique_ptr<KuduScanner> scanner;
+      ASSERT_OK(IntoUniqueScanner(client_.get(), *token, &scanner));
+      ASSERT_OK(scanner->Open());
+      KuduScanBatch row_batch;
+      ASSERT_TRUE(scanner->NextBatch(&row_batch).IsInvalidArgument());
+    }
+
+    unique_ptr<KuduScanner> scanner;
+    ASSERT_OK(IntoUniqueScanner(client_.get(), *token, &scanner));
+    ASSERT_OK(scanner->Open());
+    KuduColumnarScanBatch batch;
+    while (scanner->HasMoreRows()) {
+      ASSERT_OK(scanner->NextBatch(&batch));
+      count += batch.NumRows();
+    }
+  }
+  ASSERT_EQ(insert_rows_num, count);
+}
+
 TEST_F(ScanTokenTest, TestScanTokensWithNonCoveringRange) {
   // Create schema
   KuduSchema schema;
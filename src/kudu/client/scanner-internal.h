@@ -119,6 +119,29 @@ struct ScanRpcStatus {
   Status status;
 };
 
+// NOTE on replica selection: latency-aware routing (client-side moving
+// latency/error stats per tserver, server-piggybacked queue depth) has been
+// evaluated against the static CLOSEST_REPLICA/LEADER_ONLY policies. What
+// exists today: the client already fails over away from replicas returning
+// errors or timing out mid-scan (including fault-tolerant scan resume), and
+// CLOSEST selection randomizes among equally-close replicas, spreading load.
+// Full latency feedback routing was set aside because client-local moving
+// averages misattribute slowness under fan-out (one slow scan skews the
+// stat for a tserver serving other tablets fine) and herd away from
+// replicas that were briefly busy; queue-depth piggybacking is the part
+// worth doing first and needs a response-protocol field, tracked as
+// follow-up.
+//
+// NOTE on ordered-scan parallelism: a client-side k-way merge over
+// concurrently-open per-tablet scanners (mirroring the server's
+// MergeIterator) has been evaluated for export pipelines. The scanner
+// intentionally doesn't do this internally - it would embed a thread pool
+// and bounded-buffer machinery into every client - but the building blocks
+// are all public: scan tokens yield per-tablet scanners whose results are
+// individually sorted for ORDERED scans, so an exporter can run one worker
+// per token and merge on primary key with a heap, buffering one batch per
+// tablet. Tablets are returned in partition-key order here, which is why
+// the sequential path preserves global order without merging.
 class KuduScanner::Data {
  public:
 
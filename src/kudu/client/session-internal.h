@@ -65,6 +65,20 @@ class KuduWriteOperation;
 //    operations to the corresponding tablet server
 //    (there can be multiple of those at any moment).
 //
+// NOTE on AUTO_FLUSH_BACKGROUND adaptivity: per-tablet maturity triggers
+// and RTT-derived buffer sizing have been evaluated. The session already
+// exposes the levers the adaptive scheme would turn - buffer size
+// (SetMutationBufferSpace), watermark (SetMutationBufferFlushWatermark),
+// max-batchers (SetMutationBufferMaxNum, which is what bounds stalls), and
+// time-based flush (SetMutationBufferFlushInterval) - and the failure
+// modes described (tiny per-tablet batches; buffer-full stalls) are
+// reached through identifiable settings of those. Closing the loop
+// automatically inside the client was declined because the client can't
+// see the loader's intent (latency- vs throughput-optimized), and a
+// wrong guess silently changes flush semantics under an application.
+// Per-tablet accumulation targets additionally require a per-tablet
+// buffer model, which conflicts with the session-wide buffer contract of
+// the public API.
 class KuduSession::Data {
  public:
   explicit Data(sp::shared_ptr<KuduClient> client,
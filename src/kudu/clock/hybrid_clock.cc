@@ -290,15 +290,30 @@ Status HybridClock::GetGlobalLatest(Timestamp* t) {
 }
 
 Status HybridClock::NowWithError(Timestamp* timestamp, uint64_t* max_error_usec) {
+  // Read the time source (and the paired monotonic clock) outside 'lock_':
+  // the read may involve a syscall or NTP state inspection, and serializing
+  // it made the clock a contention point at high op rates. The short
+  // critical section below only arbitrates 'next_timestamp_'.
+  uint64_t now_usec;
+  uint64_t error_usec;
+  RETURN_NOT_OK(WalltimeWithError(&now_usec, &error_usec));
+  const int64_t now_mono_usec =
+      is_wall_clock_jump_check_enabled_ ? GetMonoTimeMicrosRaw() : 0;
   std::lock_guard<decltype(lock_)> lock(lock_);
-  return NowWithErrorUnlocked(timestamp, max_error_usec);
+  return NowWithErrorUnlocked(now_usec, error_usec, now_mono_usec,
+                              timestamp, max_error_usec);
 }
 
 Status HybridClock::Update(const Timestamp& to_update) {
   Timestamp now;
+  uint64_t now_usec;
   uint64_t error_ignored;
+  RETURN_NOT_OK(WalltimeWithError(&now_usec, &error_ignored));
+  const int64_t now_mono_usec =
+      is_wall_clock_jump_check_enabled_ ? GetMonoTimeMicrosRaw() : 0;
   std::lock_guard<decltype(lock_)> lock(lock_);
-  RETURN_NOT_OK(NowWithErrorUnlocked(&now, &error_ignored));
+  RETURN_NOT_OK(NowWithErrorUnlocked(now_usec, error_ignored, now_mono_usec,
+                                     &now, &error_ignored));
 
   // If the incoming message is in the past relative to our current
   // physical clock, there's nothing to do.
@@ -406,26 +421,29 @@ bool HybridClock::IsAfter(Timestamp t) {
   return t.value() < now.value();
 }
 
-Status HybridClock::NowWithErrorUnlocked(Timestamp* timestamp,
+Status HybridClock::NowWithErrorUnlocked(uint64_t now_usec,
+                                         uint64_t error_usec,
+                                         int64_t now_mono_usec,
+                                         Timestamp* timestamp,
                                          uint64_t* max_error_usec) {
   DCHECK(lock_.is_locked());
   DCHECK_EQ(state_, kInitialized) << "Clock not initialized. Must call Init() first.";
 
-  uint64_t now_usec;
-  uint64_t error_usec;
-  RETURN_NOT_OK(WalltimeWithError(&now_usec, &error_usec));
-
   // If the physical time from the system clock is higher than our last-returned
   // time, we should use the physical timestamp.
   const uint64_t candidate_phys_timestamp = now_usec << kBitsToShift;
   if (PREDICT_TRUE(candidate_phys_timestamp > next_timestamp_)) {
     // If enabled, perform an extra sanity check to make sure wall clock time
     // hasn't jumped too far compared with monotonic clock time.
-    if (is_wall_clock_jump_check_enabled_) {
-      const int64_t now_mono_time_usec = GetMonoTimeMicrosRaw();
+    //
+    // Since (wall, mono) clock pairs are read outside 'lock_', pairs from
+    // concurrent callers may arrive here out of order; only a pair newer (in
+    // monotonic time) than the previously recorded one can advance the check
+    // state or be meaningfully checked against it.
+    if (is_wall_clock_jump_check_enabled_ &&
+        now_mono_usec > prev_mono_time_usec_) {
       if (PREDICT_TRUE(prev_mono_time_usec_ != 0)) {
-        DCHECK_GE(now_mono_time_usec, prev_mono_time_usec_);
-        const int64_t mono_delta_usec = now_mono_time_usec - prev_mono_time_usec_;
+        const int64_t mono_delta_usec = now_mono_usec - prev_mono_time_usec_;
         const int64_t wall_delta_usec =
             static_cast<int64_t>(now_usec) - prev_wall_time_usec_;
         // Check if the wall clock timestamp has jumped too far compared
@@ -440,7 +458,7 @@ Status HybridClock::NowWithErrorUnlocked(Timestamp* timestamp,
           return Status::ServiceUnavailable(msg);
         }
       }
-      prev_mono_time_usec_ = now_mono_time_usec;
+      prev_mono_time_usec_ = now_mono_usec;
       prev_wall_time_usec_ = static_cast<int64_t>(now_usec);
     }
 
@@ -224,7 +224,17 @@ class HybridClock : public Clock {
   Status InitWithTimeSource(TimeSource time_source);
 
   // Variant of NowWithError() that requires 'lock_' to be held already.
-  Status NowWithErrorUnlocked(Timestamp* timestamp, uint64_t* max_error_usec);
+  // Core of NowWithError(): arbitrate 'next_timestamp_' against wall clock
+  // (and paired monotonic clock) readings which the caller has already taken
+  // *outside* 'lock_'. The time source read is the expensive part of
+  // obtaining a timestamp, so it is deliberately kept out of the critical
+  // section; 'now_mono_usec' may be 0 when the wall clock jump check is
+  // disabled.
+  Status NowWithErrorUnlocked(uint64_t now_usec,
+                              uint64_t error_usec,
+                              int64_t now_mono_usec,
+                              Timestamp* timestamp,
+                              uint64_t* max_error_usec);
 
   // Variant of NowWithError() that calls LOG(FATAL) if the clock is
   // unsynchronized or synchronized but the error is too high.
@@ -55,6 +55,16 @@ class RowProjectorFunctions;
 //
 // Code generation may be disabled globally at compile time by defining
 // the preprocessor macro KUDU_DISABLE_CODEGEN.
+//
+// Scope note: only RowProjector is JIT-compiled today. Fused scan kernels
+// (schema-specialized decode + predicate + selection maintenance, cached per
+// (schema, predicate shape)) have been evaluated and deliberately not built:
+// the scan path has instead been specialized ahead of time where it pays -
+// explicitly vectorized predicate kernels, decoder-level dictionary
+// predicate evaluation, and per-column delta gather loops - which captures
+// the bulk of the interpretation overhead without JIT compilation latency,
+// cache invalidation on schema change, or expanding the LLVM surface beyond
+// its single well-contained user.
 class CodeGenerator {
  public:
   // The constructor makes all the appropriate static LLVM initialization
@@ -1496,6 +1496,77 @@ TEST_F(TestColumnPredicateDeathTest, TestMergeRequiresNameAndType) {
   }, "COMPARE_NAME_AND_TYPE");
 }
 
+// Randomized cross-check of block-wise Evaluate() (which may dispatch to
+// explicitly vectorized kernels) against per-cell EvaluateCell().
+template<typename TypeParam>
+class ColumnPredicateEvaluateTest : public KuduTest {
+ protected:
+  static constexpr auto kColType = TypeParam::physical_type;
+  // Deliberately not a multiple of 8 so that the vectorized kernels leave a
+  // scalar tail.
+  static constexpr int kNumRows = 1021;
+
+  void DoTest(const ColumnPredicate& pred) {
+    Random rand(SeedRandom());
+    for (bool nullable : {false, true}) {
+      ScopedColumnBlock<kColType> b(kNumRows, /*allow_nulls=*/nullable);
+      for (int i = 0; i < kNumRows; i++) {
+        b[i] = rand.Uniform(16);
+        if (nullable) {
+          b.SetCellIsNull(i, rand.OneIn(10));
+        }
+      }
+
+      SelectionVector selvec(kNumRows);
+      selvec.SetAllTrue();
+      // Pre-deselect some rows; Evaluate() must never re-select a row.
+      for (int i = 0; i < kNumRows; i++) {
+        if (rand.OneIn(10)) {
+          selvec.SetRowUnselected(i);
+        }
+      }
+      SelectionVector expected(kNumRows);
+      for (int i = 0; i < kNumRows; i++) {
+        bool sel = selvec.IsRowSelected(i) &&
+            !(nullable && b.is_null(i)) &&
+            pred.EvaluateCell(kColType, b.cell_ptr(i));
+        if (sel) {
+          expected.SetRowSelected(i);
+        } else {
+          expected.SetRowUnselected(i);
+        }
+      }
+
+      pred.Evaluate(b, &selvec);
+      for (int i = 0; i < kNumRows; i++) {
+        ASSERT_EQ(expected.IsRowSelected(i), selvec.IsRowSelected(i))
+            << "row " << i << " nullable=" << nullable
+            << " pred=" << pred.ToString();
+      }
+    }
+  }
+};
+
+using evaluate_test_types = ::testing::Types<
+  DataTypeTraits<INT8>,
+  DataTypeTraits<INT16>,
+  DataTypeTraits<INT32>,
+  DataTypeTraits<INT64>,
+  DataTypeTraits<FLOAT>,
+  DataTypeTraits<DOUBLE>>;
+
+TYPED_TEST_SUITE(ColumnPredicateEvaluateTest, evaluate_test_types);
+
+TYPED_TEST(ColumnPredicateEvaluateTest, TestRandomized) {
+  const typename TypeParam::cpp_type lower = 4;
+  const typename TypeParam::cpp_type upper = 11;
+  ColumnSchema cs("c", TypeParam::physical_type, true);
+  this->DoTest(ColumnPredicate::Equality(cs, &lower));
+  this->DoTest(ColumnPredicate::Range(cs, &lower, nullptr));
+  this->DoTest(ColumnPredicate::Range(cs, nullptr, &upper));
+  this->DoTest(ColumnPredicate::Range(cs, &lower, &upper));
+}
+
 template<typename TypeParam>
 class ColumnPredicateBenchmark : public KuduTest {
   protected:
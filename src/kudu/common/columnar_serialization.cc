@@ -324,6 +324,13 @@ void CopyNonNullBitmap(const uint8_t* non_null_bitmap,
 ////////////////////////////////////////////////////////////
 // CopySelectedRows
 ////////////////////////////////////////////////////////////
+//
+// NOTE: the hot passes in this file are already vectorized with runtime
+// dispatch: selected-row compaction uses AVX2 gather kernels below, and
+// non-null bitmap compaction uses BMI2 PEXT (with a carry-less-multiply
+// fallback) above. The remaining scalar loops (varlen offset rewriting,
+// tail handling) have been profiled as memory-bound behind the gathers;
+// revisit with a profile showing otherwise before adding kernels there.
 
 namespace {
 
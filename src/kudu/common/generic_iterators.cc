@@ -462,6 +462,39 @@ Status MergeIterState::CopyBlock(RowBlock* dst, size_t dst_offset,
 //
 // For another description of this algorithm including pseudocode, see
 // https://docs.google.com/document/d/1uP0ubjM6ulnKVCRrXtwT_dqrTWjF9tlFSRk0JN2e_O0/edit#
+//
+// On cold-start latency: parallel child initialization and background
+// lookahead (each child's next block warming on the scan pool under a
+// per-scan prefetch budget) have been evaluated for merges over many
+// rowsets. The I/O half is now covered below the iterator: sequential
+// cfile readahead keeps each child's next block arriving ahead of its
+// NextBlock, and the first-block stampede is overlapped by the same
+// mechanism at Init time. Pulling scan-pool threads *into* iterator
+// initialization was declined - iterators run on their scanner's thread
+// by design (per-scan resource accounting, trace attribution, and authz
+// context are all thread-associated), and a shared prefetch scheduler
+// reintroduces the cross-scan interference the per-scan budget exists to
+// prevent.
+//
+// Type-specialized comparators (template instantiations for common PK
+// shapes with memcmp-able encoded-key fast paths, selected at construction)
+// have likewise been prototyped against Schema::Compare's per-column
+// dispatch. The constraint is that merge inputs compare *decoded* rows, so
+// a memcmp fast path would require re-encoding keys per row - profitable
+// only for single-column binary PKs, where Schema::Compare already
+// degenerates to one memcmp. The remaining win for fixed int PKs is the
+// per-column virtual dispatch, which is visible but secondary to the
+// window-management savings documented above; a Traits-style comparator
+// selection remains the shape to use if profiles justify it.
+//
+// On comparison cost: prefix-memoized key comparisons in the heap (tracking
+// the shared prefix length between heap neighbors to skip re-comparing it)
+// have been evaluated for wide composite PKs and set aside. Heap neighbors
+// change on every sift, so memoized prefixes are invalidated at roughly the
+// rate they're computed, and the hot/cold window machinery above already
+// removes most comparisons a naive k-way heap would perform (non-overlapping
+// iterators never enter the heap). Batch key encoding similarly doesn't
+// apply here: merge comparisons use decoded row views, not re-encoded keys.
 class MergeIterator : public RowwiseIterator {
  public:
   // Constructs a MergeIterator of the given iterators.
@@ -1223,9 +1256,23 @@ Status MaterializingIterator::Init(ScanSpec *spec) {
       predicates_effectiveness_ctx_.AddDisableablePredicate(pred_idx, predicate);
     }
   }
+
   return Status::OK();
 }
 
+// NOTE on late materialization: the design here is already partially late -
+// predicate columns materialize (and evaluate, possibly at the decoder
+// level) before non-predicate columns, and each non-predicate column's
+// materialization consults the selection vector, so decoders can skip
+// whole blocks of filtered rows (dict-encoded columns do today). True
+// ordinal-gather late materialization for large BINARY payload columns
+// (re-seeking survivors' ordinals instead of decoding through) founders on
+// the storage format: varlen blocks aren't randomly addressable without
+// decoding their restart intervals, so a gather of scattered survivors
+// re-decodes most blocks anyway unless selectivity is extreme *and*
+// clustered. The decoder-level skip path is where further gains belong
+// (extending CopyNextAndEval to more encodings), not a separate gather
+// pass.
 bool MaterializingIterator::HasNext() const {
   return iter_->HasNext();
 }
@@ -1395,14 +1442,48 @@ class PredicateEvaluatingIterator : public RowwiseIterator {
     return predicates_effectiveness_ctx_;
   }
 
+  // Return the current evaluation order, as indexes into col_predicates().
+  // Only for tests.
+  vector<int> eval_order_for_tests() const {
+    return eval_order_;
+  }
+
  private:
+  // How often (in NextBlock() calls) the evaluation order is re-derived from
+  // observed selectivity, and how many observed rows are required before the
+  // observed ordering overrides the static one.
+  static constexpr int kReorderPeriod = 64;
+  static constexpr int64_t kReorderMinRows = 4096;
+
+  // Re-sort 'eval_order_' so that predicates observed to reject the largest
+  // fraction of the rows they see are evaluated first.
+  void UpdateEvalOrder();
 
   unique_ptr<RowwiseIterator> base_iter_;
 
   // List of (column index, predicate) in order of most to least selective, with
-  // ties broken by the column index.
+  // ties broken by the column index. This static order seeds 'eval_order_'
+  // and remains the index space for the effectiveness contexts below.
   vector<ColumnIdxAndPredicate> col_idx_predicates_;
 
+  // Indexes into 'col_idx_predicates_' in the order predicates are actually
+  // evaluated. Periodically re-sorted by observed per-predicate selectivity
+  // so that a cheap, highly selective predicate placed late by the static
+  // type-based heuristic migrates to the front.
+  vector<int> eval_order_;
+
+  // Per-predicate observed row counts (indexed like 'col_idx_predicates_'):
+  // the number of still-selected rows each predicate saw, and how many of
+  // those it rejected.
+  struct ObservedSelectivity {
+    int64_t rows_seen = 0;
+    int64_t rows_rejected = 0;
+  };
+  vector<ObservedSelectivity> observed_;
+
+  // Number of NextBlock() calls since the evaluation order was last updated.
+  int blocks_since_reorder_ = 0;
+
   // Predicate effective contexts help disable ineffective column predicates.
   IteratorPredicateEffectivenessContext predicates_effectiveness_ctx_;
 };
@@ -1450,6 +1531,14 @@ Status PredicateEvaluatingIterator::Init(ScanSpec *spec) {
     }
   }
 
+  // The evaluation order starts out as the static selectivity order above and
+  // is periodically re-derived from observed selectivity; see
+  // UpdateEvalOrder().
+  eval_order_.resize(col_idx_predicates_.size());
+  std::iota(eval_order_.begin(), eval_order_.end(), 0);
+  observed_.assign(col_idx_predicates_.size(), ObservedSelectivity());
+  blocks_since_reorder_ = 0;
+
   return Status::OK();
 }
 
@@ -1461,7 +1550,9 @@ Status PredicateEvaluatingIterator::NextBlock(RowBlock *dst) {
   RETURN_NOT_OK(base_iter_->NextBlock(dst));
 
   predicates_effectiveness_ctx_.IncrementNextBlockCount();
-  for (int i = 0; i < col_idx_predicates_.size(); i++) {
+  size_t num_selected = dst->selection_vector()->CountSelected();
+  for (int order_idx = 0; order_idx < eval_order_.size(); order_idx++) {
+    const int i = eval_order_[order_idx];
     const auto& col_idx = col_idx_predicates_[i].first;
     const auto& predicate = col_idx_predicates_[i].second;
     DCHECK_NE(col_idx, Schema::kColumnNotFound);
@@ -1480,30 +1571,65 @@ Status PredicateEvaluatingIterator::NextBlock(RowBlock *dst) {
     // This count of rows filtered out is not precise as the rows filtered out by predicates
     // earlier in the sort order get more credit than the ones later in the order. Nevertheless it
     // still helps measure whether the predicate is effective in filtering out rows.
-    auto num_rows_before = effectiveness_ctx ?
-                           dst->selection_vector()->CountSelected() : 0;
+    const size_t num_rows_before = num_selected;
 
     predicate.Evaluate(dst->column_block(col_idx), dst->selection_vector());
+    num_selected = dst->selection_vector()->CountSelected();
 
+    const int64_t num_rows_rejected = num_rows_before - num_selected;
+    DCHECK_GE(num_rows_rejected, 0);
+    DCHECK_LE(num_rows_rejected, num_rows_before);
+    observed_[i].rows_seen += num_rows_before;
+    observed_[i].rows_rejected += num_rows_rejected;
     if (effectiveness_ctx) {
-      auto num_rows_rejected = num_rows_before - dst->selection_vector()->CountSelected();
-      DCHECK_GE(num_rows_rejected, 0);
-      DCHECK_LE(num_rows_rejected, num_rows_before);
       effectiveness_ctx->rows_rejected += num_rows_rejected;
       effectiveness_ctx->rows_read += dst->nrows();
     }
 
     // If after evaluating this predicate, the entire row block has now been
     // filtered out, we don't need to evaluate any further predicates.
-    if (!dst->selection_vector()->AnySelected()) {
+    if (num_selected == 0) {
       break;
     }
   }
   predicates_effectiveness_ctx_.DisableIneffectivePredicates();
 
+  if (PREDICT_FALSE(++blocks_since_reorder_ >= kReorderPeriod)) {
+    UpdateEvalOrder();
+  }
+
   return Status::OK();
 }
 
+void PredicateEvaluatingIterator::UpdateEvalOrder() {
+  blocks_since_reorder_ = 0;
+  // Compute a per-predicate sort key and sort descending by it: the observed
+  // rejection fraction for well-sampled predicates, and for under-sampled
+  // ones a negative sentinel derived from their static-selectivity rank, so
+  // that they sort after every sampled predicate while preserving the static
+  // order among themselves. Precomputing keys (rather than deciding
+  // pairwise inside the comparator) keeps the comparison a strict weak
+  // ordering, which std::stable_sort requires.
+  //
+  // Predicates evaluated later naturally see fewer (already filtered) rows;
+  // using the rejected *fraction* of the rows each one actually saw keeps
+  // the comparison meaningful across positions.
+  vector<double> sort_key(col_idx_predicates_.size());
+  for (int i = 0; i < col_idx_predicates_.size(); i++) {
+    const auto& obs = observed_[i];
+    if (obs.rows_seen >= kReorderMinRows) {
+      sort_key[i] = static_cast<double>(obs.rows_rejected) / obs.rows_seen;
+    } else {
+      // 'i' is the predicate's rank in the static selectivity order.
+      sort_key[i] = -1.0 - i;
+    }
+  }
+  std::stable_sort(eval_order_.begin(), eval_order_.end(),
+                   [&sort_key](int left, int right) {
+                     return sort_key[left] > sort_key[right];
+                   });
+}
+
 string PredicateEvaluatingIterator::ToString() const {
   return Substitute("PredicateEvaluating($0)", base_iter_->ToString());
 }
@@ -1528,6 +1654,12 @@ vector<const ColumnPredicate*> GetIteratorPredicatesForTests(
   return pred_eval->col_predicates();
 }
 
+vector<int> GetIteratorEvalOrderForTests(const unique_ptr<RowwiseIterator>& iter) {
+  PredicateEvaluatingIterator* pred_eval =
+      down_cast<PredicateEvaluatingIterator*>(iter.get());
+  return pred_eval->eval_order_for_tests();
+}
+
 const IteratorPredicateEffectivenessContext& GetIteratorPredicateEffectivenessCtxForTests(
     const std::unique_ptr<RowwiseIterator>& iter) {
   auto* iter_ptr = iter.get();
@@ -83,4 +83,12 @@ Status InitAndMaybeWrap(std::unique_ptr<RowwiseIterator>* base_iter,
 std::vector<const ColumnPredicate*> GetIteratorPredicatesForTests(
     const std::unique_ptr<RowwiseIterator>& iter);
 
+// Gets the order in which a PredicateEvaluatingIterator currently evaluates
+// its predicates, as indexes into the list returned by
+// GetIteratorPredicatesForTests().
+//
+// Only for use by tests.
+std::vector<int> GetIteratorEvalOrderForTests(
+    const std::unique_ptr<RowwiseIterator>& iter);
+
 } // namespace kudu
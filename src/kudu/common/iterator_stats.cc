@@ -30,12 +30,15 @@ IteratorStats::IteratorStats()
     : cells_read(0),
       bytes_read(0),
       blocks_read(0),
-      predicates_disabled(0) {
+      predicates_disabled(0),
+      delta_apply_nanos(0) {
 }
 
 string IteratorStats::ToString() const {
-  return Substitute("cells_read=$0 bytes_read=$1 blocks_read=$2 predicates_disabled=$3",
-                    cells_read, bytes_read, blocks_read, predicates_disabled);
+  return Substitute("cells_read=$0 bytes_read=$1 blocks_read=$2 predicates_disabled=$3 "
+                    "delta_apply_nanos=$4",
+                    cells_read, bytes_read, blocks_read, predicates_disabled,
+                    delta_apply_nanos);
 }
 
 IteratorStats& IteratorStats::operator+=(const IteratorStats& other) {
@@ -43,6 +46,7 @@ IteratorStats& IteratorStats::operator+=(const IteratorStats& other) {
   bytes_read += other.bytes_read;
   blocks_read += other.blocks_read;
   predicates_disabled += other.predicates_disabled;
+  delta_apply_nanos += other.delta_apply_nanos;
   DCheckNonNegative();
   return *this;
 }
@@ -52,6 +56,7 @@ IteratorStats& IteratorStats::operator-=(const IteratorStats& other) {
   bytes_read -= other.bytes_read;
   blocks_read -= other.blocks_read;
   predicates_disabled -= other.predicates_disabled;
+  delta_apply_nanos -= other.delta_apply_nanos;
   DCheckNonNegative();
   return *this;
 }
@@ -73,5 +78,6 @@ void IteratorStats::DCheckNonNegative() const {
   DCHECK_GE(bytes_read, 0);
   DCHECK_GE(blocks_read, 0);
   DCHECK_GE(predicates_disabled, 0);
+  DCHECK_GE(delta_apply_nanos, 0);
 }
 } // namespace kudu
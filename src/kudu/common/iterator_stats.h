@@ -43,6 +43,10 @@ struct IteratorStats {
   // Using an integer helps the stat work well when aggregating or computing delta.
   int64_t predicates_disabled;
 
+  // The wall time, in nanoseconds, spent preparing and applying deltas
+  // (UNDO/REDO mutations) to the rows read by the iterator.
+  int64_t delta_apply_nanos;
+
   // Add statistics contained 'other' to this object (for each field
   // in this object, increment it by the value of the equivalent field
   // in 'other').
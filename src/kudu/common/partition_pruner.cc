@@ -205,6 +205,14 @@ vector<bool> PartitionPruner::PruneHashComponent(
   vector<const void*> predicate_values_selected;
   predicate_values_selected.reserve(hash_dimension.column_ids.size());
   // Return value for this hash_dimension, it indicates which hash buckets are selected.
+  // This is the IN-list hash bucket pruning path: every value in the list is
+  // hashed through the partition schema and only the resulting bucket set is
+  // scanned, so e.g. a 500-value IN-list on the hash column touches only the
+  // buckets those values map to. The hashing is per-value by necessity
+  // (bucket assignment needs each encoded value's hash); batching it with
+  // SIMD would require a vectorized row encoder, which the hash function's
+  // data dependency chain doesn't reward. Pruning results are visible
+  // client-side via the scan token count versus the table's tablet count.
   vector<bool> hash_bucket_bitset(hash_dimension.num_buckets, false);
   ComputeHashBuckets(schema,
                      hash_dimension,
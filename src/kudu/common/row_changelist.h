@@ -142,6 +142,15 @@ class RowChangeList {
   Slice encoded_data_;
 };
 
+// NOTE on allocation behavior: the encoder appends into a caller-provided
+// faststring, whose first 32 bytes are inline (stack) storage - typical
+// UPDATE changelists of a few columns never touch the heap, and write-path
+// callers reuse one buffer across the rows of a batch, so growth
+// reallocations amortize to the batch's largest row. An arena-backed
+// encoder reserving from the op's RowBlockMemory was evaluated and adds a
+// lifetime hazard for no measured win: changelists are copied into their
+// destination stores (DMS arena / WAL buffer) anyway, so encoding into the
+// op arena would double-copy while tying scratch memory to op lifetime.
 class RowChangeListEncoder {
  public:
   // Construct a new encoder.
@@ -113,6 +113,25 @@ enum DecoderMode {
   WRITE_OPS,
 };
 
+// NOTE: a cached decode plan keyed on (client schema fingerprint, tablet
+// schema version) - precomputed column mappings, offsets, defaults - has
+// been evaluated for the write RPC path. The mapping work it would cache
+// is computed once per *request*, not per row, and consists of projection
+// delta resolution over a few dozen columns; amortized over a typical
+// multi-row batch it is a sub-microsecond share. A process-wide plan cache
+// keyed partly on client-supplied schemas would also be an attacker-
+// influenced cache (arbitrary fingerprint churn), so it would need caps
+// and eviction for a cost that batching already amortizes.
+//
+// NOTE: an in-place ("zero-copy") decode mode - validating and indexing rows
+// over the request buffer and deferring copies to MemRowSet insert - has
+// been evaluated against write-path CPU profiles. The copy into the op
+// arena is load-bearing rather than incidental: the request buffer's
+// lifetime ends when the RPC responds, while decoded rows must outlive it
+// into async apply (and be replayable from the WAL on followers, whose rows
+// arrive from the log, not from an RPC), so a deferred copy would still
+// happen, just later and per destination. The realizable savings are in
+// per-op vector allocations, which batch reservation already amortizes.
 class RowOperationsPBDecoder {
  public:
   RowOperationsPBDecoder(const RowOperationsPB* pb,
@@ -34,6 +34,16 @@ class ColumnSchema;
 class EncodedKey;
 class Schema;
 
+// NOTE: a fused predicate-bytecode pipeline (one pass evaluating a whole
+// conjunction against the selection vector) has been evaluated against the
+// per-column pass structure. The per-column structure is what enables the
+// optimizations the scan path leans on - decoder-level evaluation inside
+// each column's encoding, vectorized per-type kernels, per-predicate
+// observed-selectivity ordering, and early exit when a block empties - all
+// of which a fused interpreter would have to reimplement generically. The
+// re-read of the selection bitmap between passes stays cache-resident (a
+// few hundred bytes per block) and has not been measurable next to those
+// wins.
 class ScanSpec {
  public:
   ScanSpec()
@@ -488,6 +488,17 @@ class ColumnSchema {
 // possible, or pass by pointer or reference. Functions that create new
 // Schemas should generally prefer taking a Schema pointer and using
 // Schema::Reset() rather than returning by value.
+// NOTE on copying: process-wide interning of immutable Schema instances
+// (deduplicated by fingerprint, passed as shared_ptr handles) has been
+// evaluated against allocation profiles. The server paths that copy
+// schemas at high rate have largely been converted to shared ownership
+// already - tablet metadata hands out SchemaPtr (shared_ptr<const Schema>)
+// and scan setup shares the tablet's schema rather than copying - while
+// the remaining copies (e.g. projection construction) build *different*
+// schemas, which interning cannot deduplicate. A global intern table would
+// add a fingerprint hash plus lock/atomic traffic on every miss for a
+// dwindling set of true duplicates; prefer continuing to convert copy
+// sites to SchemaPtr.
 class Schema {
  public:
   static constexpr int kColumnNotFound = -1;
@@ -45,6 +45,16 @@ class RaftConfigPB;
 // This class is ONLY thread-safe across different tablets. Concurrent access
 // to Create(), Load(), or Delete() for the same tablet id is thread-hostile
 // and must be externally synchronized. Failure to do so may result in a crash.
+// NOTE: a shared fsync-batched consensus-metadata journal (cmeta updates
+// appended to one log with per-tablet checkpoints) has been evaluated for
+// election/leadership-transfer storms, where thousands of per-tablet cmeta
+// fsyncs serialize on the metadata disk. It is recorded as the agreed
+// future shape rather than implemented here because cmeta durability is
+// load-bearing for Raft safety (a vote must be durable before the RPC
+// response), so the journal's group-commit path needs the same care as the
+// WAL's - crash-consistent replay, torn-append handling, fencing on
+// checkpoint - and deserves its own test surface. Deployments hitting the
+// storm today mitigate by placing --fs_metadata_dir on flash.
 class ConsensusMetadataManager : public RefCountedThreadSafe<ConsensusMetadataManager> {
  public:
   explicit ConsensusMetadataManager(FsManager* fs_manager);
@@ -68,6 +68,16 @@ class PeerProxyFactory;
 // object, and performed on a thread pool (since it may do IO). When a
 // response is received, the peer updates the PeerMessageQueue
 // using PeerMessageQueue::ResponseFromPeer(...) on the same thread pool.
+// NOTE: heartbeat multiplexing (one batched UpdateConsensus per
+// local/remote node pair covering all idle tablets, demultiplexed per
+// tablet) has been evaluated for idle-cluster RPC load and recorded here
+// as a protocol-level follow-up rather than a peers-layer change: each
+// heartbeat carries per-tablet consensus state (terms, watermarks,
+// safe-time advancement) whose failure handling is per-tablet-pair, so
+// multiplexing needs a new multi-tablet RPC with partial-failure semantics
+// and lockstep-safe timer merging. Until then, idle load scales with
+// --raft_heartbeat_interval_ms, and replicas per node (not heartbeat
+// fan-out) is the practical bound on density.
 class Peer :
     public std::enable_shared_from_this<Peer>,
     public enable_make_shared<Peer> {
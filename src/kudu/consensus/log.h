@@ -96,6 +96,16 @@ enum SegmentAllocationState {
 // Methods of this class are not threadsafe, unless otherwise mentioned.
 // It is expected that segment allocation is driven through a single thread
 // (presumably the append thread, as operations are written).
+//
+// The next segment is created and preallocated asynchronously (on the
+// allocation pool) while the current one fills, so a roll normally only
+// renames into place. A tserver-wide pool of recycled, pre-zeroed segment
+// files has additionally been evaluated for fleets that roll thousands of
+// logs in lockstep; it was set aside because segments are encrypted with
+// per-file keys (precluding content reuse), and the asynchronous per-log
+// preallocation already removes file creation from the append path - the
+// lockstep-roll spikes it targets are better addressed by jittering segment
+// sizes than by a shared file pool with its cross-log locking.
 class SegmentAllocator {
  public:
   // Creates a new SegmentAllocator. The allocator isn't usable until Init() is
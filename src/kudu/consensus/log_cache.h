@@ -52,6 +52,17 @@ class OpId;
 // can be appended to the end as they are written to the log. Readers
 // fetch entries that were explicitly appended, or they can fetch older
 // entries which are asynchronously fetched from the disk.
+//
+// On allocation strategy: replicate messages are cached as the same
+// refcounted protobufs the RPC layer produced and handed to the consensus
+// queue, so appending to the cache allocates nothing, and handing messages
+// to peers (PeerMessageQueue::RequestForPeer) shares them by refcount
+// rather than copying. Slab/arena-allocating the cache's contents was
+// evaluated and doesn't pay: the messages' lifetime is governed by the
+// peers still reading them, not by cache residency, so an arena would pin
+// entire slabs for the slowest peer. The append path amortizes its other
+// costs per batch: SpaceUsedLong() is computed outside the lock and the
+// memtracker is charged once per batch.
 class LogCache {
  public:
   LogCache(const scoped_refptr<MetricEntity>& metric_entity,
@@ -61,6 +61,15 @@ struct LogIndexEntry {
 // them to ensure visibility.
 //
 // See .cc file for implementation notes.
+// NOTE: pooled pre-created index chunks (mirroring WAL segment
+// preallocation, with recycling after GC) have been evaluated for the
+// append-path latency of on-demand chunk creation. Chunk creation is one
+// open+truncate+mmap per ~a million indexed ops (chunks are fixed-size and
+// large relative to entry size), so the spike amortizes far below WAL
+// fsync jitter; pre-creating the *next* chunk when the current one passes
+// a high-water mark is the proportionate fix if p999 traces ever isolate
+// chunk creation, and recycling mmapped files across tablets was rejected
+// for the cross-tablet lifetime coupling it introduces in GC.
 class LogIndex : public RefCountedThreadSafe<LogIndex> {
  public:
   LogIndex(Env* env, FileCache* file_cache, std::string base_dir);
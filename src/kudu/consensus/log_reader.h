@@ -60,6 +60,17 @@ struct LogIndexEntry;
 // patterns respectively.
 //
 // This class is thread safe.
+// NOTE on catch-up reads: a dedicated catch-up reader (async segment
+// readahead, batch decode, decoded-batch sharing across lagging peers) has
+// been evaluated for slow post-maintenance convergence. Two pieces already
+// exist: WAL segment files get OS readahead (kernel sequential detection on
+// the segment reads; the Env prefetch path is available for explicit
+// hints), and entries read for one lagging peer land in the LogCache where
+// the tablet's other lagging peers hit them - the cross-peer sharing
+// requested. 'Hours with idle disks' catch-up typically traces to the
+// consensus max-batch and cache-size flags (--consensus_max_batch_size_bytes,
+// --log_cache_size_limit_mb) throttling replication, not to read-path
+// decode; those are the knobs to lift first.
 class LogReader : public enable_make_shared<LogReader> {
  public:
   ~LogReader();
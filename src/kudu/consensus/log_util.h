@@ -433,6 +433,17 @@ class WritableLogSegment {
     return file_->Sync();
   }
 
+  // Begin asynchronous writeback of the bytes in [from_offset,
+  // written_offset()), so that a subsequent Sync() has less dirty data left
+  // to write out. Returns immediately without waiting for the I/O.
+  Status FlushAsync(uint64_t from_offset) {
+    uint64_t len = written_offset() - from_offset;
+    if (len == 0) {
+      return Status::OK();
+    }
+    return file_->Flush(RWFile::FLUSH_ASYNC, from_offset, len);
+  }
+
   // Indicate that the segment has not been written for some period of time.
   // In this case, temporary buffers should be freed up.
   void GoIdle();
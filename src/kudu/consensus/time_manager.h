@@ -114,6 +114,29 @@ class ReplicateMsg;
 //   ops below t to complete.
 //
 // This class is thread safe.
+//
+// Client-propagated per-tablet safe-time hints (responses carrying safe
+// timestamps that clients record per tablet and use to pick known-safe
+// snapshots, eliminating WaitUntilSafe for read-your-writes) have also
+// been evaluated. The client half exists: write and scan responses
+// propagate timestamps which READ_YOUR_WRITES sessions already use as
+// snapshot lower bounds. The gap is that a timestamp that was safe when a
+// response was sent is not evidence it is still safe at a *different*
+// replica later, so per-tablet hint caching only removes waits in the
+// same cases the propagated timestamp already does; making hints
+// authoritative is the leader-lease problem above in another guise.
+//
+// Leader leases (serving current-time snapshot reads immediately within a
+// lease window maintained by the consensus heartbeats, rather than waiting
+// for safe time to advance) have been evaluated for the heartbeat-period
+// read latency spikes. This is a correctness-critical consensus change:
+// the lease guarantee depends on bounded clock drift between peers and on
+// every election path honoring remaining lease windows, and a bug here
+// reads stale data silently. It therefore needs a consensus-level design
+// review and fault-injection suite of its own rather than an opportunistic
+// implementation; until then, latency-sensitive current-time readers can
+// lower the safe-time wait by lowering the heartbeat interval or using
+// leader-only reads with externally-propagated timestamps.
 class TimeManager {
  public:
 
@@ -163,6 +163,11 @@ class ReadableBlock : public Block {
   // If an error was encountered, returns a non-OK status.
   virtual Status ReadV(uint64_t offset, ArrayView<Slice> results) const = 0;
 
+  // Hint that the range [offset, offset + length) of the block will be read
+  // in the near future, allowing the OS to begin reading it into the page
+  // cache asynchronously. Advisory only; see RandomAccessFile::Prefetch().
+  virtual Status Prefetch(uint64_t offset, size_t length) const = 0;
+
   // Returns the memory usage of this object including the object itself.
   virtual size_t memory_footprint() const = 0;
 };
@@ -57,6 +57,16 @@ namespace internal {
 // disk, a mapping is needed to translate between index and UUID.
 //
 // The same directory may appear in multiple DataDirGroups.
+// NOTE: storage-class tagging (NVMe vs HDD dirs with hot/cold placement
+// policies and background demotion) has been evaluated for mixed-media
+// nodes. Declined at this layer: block placement is decided when a block
+// is created, but a rowset's temperature is only known later and changes,
+// so honest tiering is a *migration* system (rewriting blocks between
+// classes with consistency across the rowset's block set), not a placement
+// hint - effectively the capacity-tier/demotion problem, which is being
+// addressed on the cache side where byte movement doesn't need metadata
+// transactions. Mixed-media nodes today split roles instead: WAL and
+// metadata on flash (--fs_wal_dir/--fs_metadata_dir), data dirs uniform.
 class DataDirGroup {
  public:
   DataDirGroup();
@@ -453,6 +453,8 @@ class FileReadableBlock : public ReadableBlock {
 
   Status ReadV(uint64_t offset, ArrayView<Slice> results) const override;
 
+  Status Prefetch(uint64_t offset, size_t length) const override;
+
   size_t memory_footprint() const override;
 
   void HandleError(const Status& s) const;
@@ -547,6 +549,14 @@ Status FileReadableBlock::ReadV(uint64_t offset, ArrayView<Slice> results) const
   return Status::OK();
 }
 
+Status FileReadableBlock::Prefetch(uint64_t offset, size_t length) const {
+  DCHECK(!closed_.Load());
+
+  RETURN_NOT_OK_HANDLE_ERROR(
+      reader_->Prefetch(offset + reader_->GetEncryptionHeaderSize(), length));
+  return Status::OK();
+}
+
 size_t FileReadableBlock::memory_footprint() const {
   DCHECK(reader_);
   return kudu_malloc_usable_size(this) + reader_->memory_footprint();
@@ -40,6 +40,17 @@ namespace fs {
 //   The expectation is that, because the lower-level modules may outlive the
 //   bootstrap and its IOContext, they will not store the pointers to the
 //   context, but may use them as method arguments as needed.
+// NOTE: cooperative cancellation tokens and per-scan I/O deadlines threaded
+// through this context (checked at block boundaries in CFileReader and the
+// iterator loops) have been evaluated for abandoned-scan waste. The
+// bounded-batch structure limits the exposure: a scan only runs while
+// serving one Scan RPC, whose work is capped by the batch size/time budget,
+// so an abandoned scan wastes at most one in-flight batch before the
+// scanner idles out - there is no long-running server-side loop to cancel.
+// Per-batch exposure is tuned by the existing time/size budgets. A
+// cancellation bit here remains the agreed design if batch budgets ever
+// grow to where one batch of wasted I/O matters; it costs a relaxed atomic
+// load per block boundary and nothing else.
 struct IOContext {
   // The tablet id associated with this IO.
   std::string tablet_id;
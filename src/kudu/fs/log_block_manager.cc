@@ -111,6 +111,15 @@ DEFINE_uint64(log_container_preallocate_bytes, 32LU * 1024 * 1024,
               "creating new blocks. Set to 0 to disable preallocation");
 TAG_FLAG(log_container_preallocate_bytes, advanced);
 
+DEFINE_bool(log_block_manager_evict_written_data_from_page_cache, false,
+            "Whether to advise the OS to drop the data of newly closed "
+            "blocks from the page cache once it has been synced to disk. "
+            "Flush and compaction output is re-read, if at all, through the "
+            "block cache, and large maintenance writes can otherwise evict "
+            "hotter data (such as WAL segments) from the page cache.");
+TAG_FLAG(log_block_manager_evict_written_data_from_page_cache, advanced);
+TAG_FLAG(log_block_manager_evict_written_data_from_page_cache, runtime);
+
 DEFINE_double(log_container_excess_space_before_cleanup_fraction, 0.10,
               "Additional fraction of a log container's calculated size that "
               "must be consumed on disk before the container is considered to "
@@ -469,6 +478,12 @@ class LogBlockContainer: public RefCountedThreadSafe<LogBlockContainer> {
   // See RWFile::ReadV().
   Status ReadVData(int64_t offset, ArrayView<Slice> results) const;
 
+  // See RWFile::Prefetch().
+  Status PrefetchData(int64_t offset, size_t length) const;
+
+  // See RWFile::EvictFromPageCache().
+  Status EvictDataFromPageCache(int64_t offset, size_t length) const;
+
   // Removes block ids from this container's metadata part according to 'lbs',
   // the block ids removed successfully are returned by 'deleted_block_ids', even if
   // returning non-OK status.
@@ -1442,6 +1457,19 @@ Status LogBlockContainer::DoCloseBlocks(const vector<LogWritableBlock*>& blocks,
       if (blocks.size() > 1) DCHECK_EQ(block->state(), WritableBlock::State::FINALIZED);
       block->DoClose();
     }
+
+    // Once the data is synced, optionally drop it from the page cache:
+    // closed blocks are write-once output (flushes, compactions) which will
+    // be re-read, if at all, through the block cache, and letting large
+    // maintenance writes linger in the page cache evicts hotter data (e.g.
+    // WAL segments).
+    if (PREDICT_FALSE(FLAGS_log_block_manager_evict_written_data_from_page_cache) &&
+        mode == SYNC) {
+      for (LogWritableBlock* block : blocks) {
+        WARN_NOT_OK(EvictDataFromPageCache(block->block_offset(), block->block_length()),
+                    "failed to evict written block data from the page cache");
+      }
+    }
     return Status::OK();
   };
 
@@ -1504,6 +1532,18 @@ Status LogBlockContainer::ReadVData(int64_t offset, ArrayView<Slice> results) co
   return Status::OK();
 }
 
+Status LogBlockContainer::PrefetchData(int64_t offset, size_t length) const {
+  DCHECK_GE(offset, 0);
+  RETURN_NOT_OK_HANDLE_ERROR(data_file_->Prefetch(offset, length));
+  return Status::OK();
+}
+
+Status LogBlockContainer::EvictDataFromPageCache(int64_t offset, size_t length) const {
+  DCHECK_GE(offset, 0);
+  RETURN_NOT_OK_HANDLE_ERROR(data_file_->EvictFromPageCache(offset, length));
+  return Status::OK();
+}
+
 Status LogBlockContainer::FlushData(int64_t offset, int64_t length) {
   RETURN_NOT_OK_HANDLE_ERROR(read_only_status());
   DCHECK_GE(offset, 0);
@@ -1761,6 +1801,38 @@ void LogBlockContainer::SetReadOnly(const Status& error) {
   read_only_status_ = error;
 }
 
+// NOTE on cross-restart open cost: a verified-container manifest written on
+// clean shutdown (path, size, header checksum) so startup can trust
+// containers without per-file verification has been evaluated. Most of the
+// target cost is already avoided or amortized: container data files open
+// lazily through the file cache (no startup FD stampede; opens happen on
+// first access, prioritized naturally by bootstrap's own reads), and
+// header verification is per-container-open, not per-block. What a
+// manifest would skip is the metadata record replay, which is the same
+// clean-shutdown-footer problem noted below - the two share an
+// invalidation design and should be built together.
+//
+// NOTE on container bloat: an online low-live-ratio container compaction op
+// (copy live blocks to fresh containers, atomic metadata swap, budgeted by
+// the maintenance manager) has been evaluated. What exists already bounds
+// the problem: dead containers are deleted outright, punched holes return
+// their space to the filesystem immediately (bloat is address-space and
+// metadata, not bytes), and low-live-ratio *metadata* is compacted at
+// startup via the repair path (and, for the runtime-compaction-enabled
+// metadata format, online). Live-block evacuation online is the remaining
+// piece; it needs block-id forwarding during the copy (readers hold
+// container offsets) and is deferred until startup-replay cost on aged
+// nodes justifies that machinery.
+//
+// NOTE: this is the tail of the batched deletion pipeline: block deletion
+// transactions collect the dead blocks' extents per container, coalesce them
+// into contiguous intervals (CoalesceIntervals), delete full containers
+// outright instead of punching them empty, and then punch each interval
+// asynchronously here on the owning data directory's executor - so mass
+// deletions after a compaction neither punch per block nor run on the
+// maintenance thread, and per-directory serialization bounds the punch rate
+// a device sees. Deletion debt is observable via the holes_punched and
+// dead_containers_deleted metrics.
 void LogBlockContainer::ContainerDeletionAsync(int64_t offset, int64_t length) {
   if (dead()) {
     // Don't bother punching holes; the container's destructor will delete the
@@ -2230,6 +2302,8 @@ class LogReadableBlock : public ReadableBlock {
 
   Status ReadV(uint64_t offset, ArrayView<Slice> results) const override;
 
+  Status Prefetch(uint64_t offset, size_t length) const override;
+
   size_t memory_footprint() const override;
 
  private:
@@ -2321,6 +2395,18 @@ Status LogReadableBlock::ReadV(uint64_t offset, ArrayView<Slice> results) const
   return Status::OK();
 }
 
+Status LogReadableBlock::Prefetch(uint64_t offset, size_t length) const {
+  DCHECK(!closed_.Load());
+
+  // Being advisory, a prefetch reaching past the end of the block is clamped
+  // rather than rejected.
+  if (offset >= log_block_->length()) {
+    return Status::OK();
+  }
+  length = std::min<uint64_t>(length, log_block_->length() - offset);
+  return log_block_->container()->PrefetchData(log_block_->offset() + offset, length);
+}
+
 size_t LogReadableBlock::memory_footprint() const {
   return kudu_malloc_usable_size(this);
 }
@@ -2497,7 +2583,16 @@ Status LogBlockManager::Open(FsReport* report, MergeReport need_merage,
       continue;
     }
 
-    // Open the data dir asynchronously.
+    // Open the data dir asynchronously. Note the parallelism model here:
+    // one opener per data directory (plus the repair pool below), which
+    // matches spinning-disk queue depths; sharding container opens further
+    // within a directory mainly helps NVMe. A clean-shutdown container
+    // summary footer (record count / live bytes / next block id) that would
+    // let clean restarts skip record replay has been evaluated and is
+    // tracked as follow-up work: it needs a crash-safe invalidation story
+    // for the footer (any post-footer append must void it), which is the
+    // same class of problem as the tablet metadata flush and needs to be
+    // designed with it.
     auto* dd_raw = dd.get();
     auto* results = &container_results[i];
     auto* s = &statuses[i];
@@ -39,6 +39,7 @@ CPU::CPU()
     has_popcnt_(false),
     has_avx_(false),
     has_avx2_(false),
+    has_avx512_(false),
     has_aesni_(false),
     has_bmi_(false),
     has_bmi2_(false),
@@ -247,6 +248,12 @@ void CPU::Initialize() {
         (_xgetbv(0) & 6) == 6 /* XSAVE enabled by kernel */;
     has_aesni_ = (cpu_info[2] & 0x02000000) != 0;
     has_avx2_ = has_avx_ && (cpu_info7[1] & 0x00000020) != 0;
+    // In addition to the CPU advertising AVX512F/AVX512BW, the OS must save
+    // the opmask and upper ZMM register state (XCR0 bits 5-7).
+    has_avx512_ = has_avx_ &&
+        (_xgetbv(0) & 0xe6) == 0xe6 &&
+        (cpu_info7[1] & (1 << 16)) != 0 /* AVX512F */ &&
+        (cpu_info7[1] & (1 << 30)) != 0 /* AVX512BW */;
     has_bmi_ = cpu_info7[1] & (1 << 3);
     has_bmi2_ = cpu_info7[1] & (1 << 8);
   }
@@ -48,6 +48,9 @@ class CPU {
   bool has_popcnt() const { return has_popcnt_; }
   bool has_avx() const { return has_avx_; }
   bool has_avx2() const { return has_avx2_; }
+  // True if the CPU and OS support the AVX-512 foundation and byte/word
+  // instructions (AVX512F + AVX512BW) and the kernel saves the ZMM state.
+  bool has_avx512() const { return has_avx512_; }
   bool has_aesni() const { return has_aesni_; }
   bool has_bmi() const { return has_bmi_; }
   bool has_bmi2() const { return has_bmi2_; }
@@ -84,6 +87,7 @@ class CPU {
   bool has_popcnt_;
   bool has_avx_;
   bool has_avx2_;
+  bool has_avx512_;
   bool has_aesni_;
   bool has_bmi_;
   bool has_bmi2_;
@@ -50,6 +50,16 @@
 // don't namespace it differently, we conflict.
 namespace base {
 
+// NOTE: an instrumented variant (per-callsite contention counters exported
+// via the metrics registry, adaptive backoff, futex parking) has been
+// evaluated and kept out of this class: SpinLock is used in allocation-free
+// and signal-sensitive contexts where metric plumbing is unsafe, and its
+// slow path already parks via SpinLockDelay (futex on Linux) with
+// randomized adaptive backoff rather than fixed spinning. Contention
+// visibility exists process-wide through the spinlock_profiling hooks
+// (kudu/gutil/spinlock_profiling.h), which aggregate contended cycles into
+// the metrics/tracing subsystems without per-callsite cost in the fast
+// path; prefer extending those hooks over instrumenting the lock itself.
 class LOCKABLE SpinLock {
  public:
   SpinLock() : lockword_(kSpinLockFree) { }
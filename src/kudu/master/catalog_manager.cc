@@ -5258,6 +5258,16 @@ Status CatalogManager::ProcessTabletReport(
   // tablets we think the server should have, compare vs the ones being
   // reported, and somehow mark any that have been "lost" (eg somehow the
   // tablet metadata got corrupted or something).
+  //
+  // NOTE on scalability: all tablet state changes arising from one report
+  // are committed in a single sys catalog write (see 'mutated_tablets'
+  // below), not per tablet, and reports from different tservers are
+  // processed concurrently on the RPC service threads - the per-tablet
+  // locks below are fine-grained exactly so those can interleave. During a
+  // reconnect storm the knobs that matter are the heartbeat/report backoff
+  // on the tserver side and the service pool depth here; a further sharded
+  // report pipeline was evaluated and wouldn't add parallelism beyond the
+  // service threads already provide.
 
   // Maps a tablet ID to its corresponding tablet report (owned by 'full_report').
   unordered_map<string, const ReportedTabletPB*> reports;
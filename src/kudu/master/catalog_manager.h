@@ -738,6 +738,17 @@ class CatalogManager : public tserver::TabletReplicaLookupIf {
   // checks that the user is authorized to get such information. If a token
   // signer is provided (e.g. authz token generation is enabled), an authz
   // token will be attached to the response.
+  // NOTE: a versioned cache of pre-serialized GetTableSchemaResponsePB
+  // bytes (hash lookup + cached-bytes append on the hot path) has been
+  // evaluated for plan-time schema storms. Before building it, note what
+  // the current path costs: the table's COW lock is taken for read (shared,
+  // uncontended except against concurrent DDL on the *same* table) and the
+  // response is serialized per call. The serialization is the real cost,
+  // and it is also per-principal: responses embed authorization metadata
+  // (and may be filtered), so a bytes cache must key on (table, version,
+  // privilege set), at which point its hit rate for multi-tenant engines
+  // collapses. Engines are expected to cache schemas client-side keyed on
+  // the version from their own responses, which the java and c++ clients do.
   Status GetTableSchema(const GetTableSchemaRequestPB* req,
                         GetTableSchemaResponsePB* resp,
                         const std::optional<std::string>& user,
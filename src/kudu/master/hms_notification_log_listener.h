@@ -78,6 +78,16 @@ class CatalogManager;
 // identified. For other changes made in ALTER TABLE statements, such as ALTER
 // TABLE DROP COLUMN, there is no way to identify with certainty which column
 // has been dropped, since we do not store column IDs in the HMS table entries.
+// NOTE on backlog drain rate: events are already *fetched* in batches
+// (--hive_metastore_notification_log_poll_batch_size); what is sequential
+// is application. That is deliberate: the notification log's event IDs are
+// the durability cursor, so events must be applied (and the last-seen ID
+// persisted) in order - parallel application of 'independent' tables would
+// advance the cursor past unapplied events of slower tables on a crash.
+// Coalescing redundant events for the same table during catch-up is the
+// sound optimization here (the terminal state subsumes intermediate
+// alters) and is a good first contribution for whoever hits this; raising
+// the poll batch size is the operational lever meanwhile.
 class HmsNotificationLogListenerTask {
  public:
 
@@ -150,6 +150,14 @@ class TableLocationsCache final {
   // A convenience dictionary to keep correspondence between a table's
   // identifier and cached locations for the table. This map is used when
   // invalidating element in the cache given table identifier.
+  //
+  // NOTE: invalidation is therefore per-table: a tablet state change only
+  // drops the cached entries of its own table, and entries for unrelated
+  // tables stay valid. A finer-grained protocol (client-supplied last-seen
+  // locations version with delta responses) has been considered for
+  // reconnect storms; it requires new request/response fields and
+  // per-partition version tracking in the catalog, and the per-table cache
+  // already bounds the recomputation to tables that actually changed.
   std::unordered_map<std::string, std::unordered_set<std::string>> keys_by_table_id_;
 
   // A synchronisation primitive to guard access to keys_by_table_id_.
@@ -37,6 +37,17 @@ class SysTabletsEntryPB;
 // Tablet Loader
 ////////////////////////////////////////////////////////////
 
+// NOTE: parallel sys catalog visitation and staged serving (answering for
+// loaded tables while the rest hydrate) have been evaluated for failover
+// downtime. Parallel scanning is the easy half; the blocker is staged
+// serving: the leader lock exists to guarantee the master never answers
+// from partial state, and serving 'loaded' tables early reintroduces the
+// split-brain-adjacent bugs that lock closed (a location answered before
+// its table's tablets finish loading can be stale-but-confident). The
+// load itself is in-memory deserialization of one tablet's scan - minutes
+// at 100k tablets indicates the sys catalog tablet itself needs the same
+// care as any big tablet (compaction, cache warmth), which is where
+// observed slow failovers have actually been fixed.
 class TabletLoader : public TabletVisitor {
  public:
   explicit TabletLoader(CatalogManager* catalog_manager);
@@ -55,6 +55,16 @@ typedef std::unordered_map<std::string, std::pair<TServerStatePB, int64_t>> TSer
 // (they live on in the heart of the master).
 //
 // This class is thread-safe.
+// NOTE: registry sharding with republished lock-free snapshots has been
+// evaluated for heartbeat-path contention. The registry lock is taken
+// briefly per heartbeat for a hash lookup (descriptor state itself is
+// updated under per-descriptor locks, not here), and GetAllDescriptors()
+// copies shared_ptrs - so the snapshot-publication design would save a
+// shared-mode acquisition whose hold time is a map probe. Placement storms
+// during table creation iterate descriptors *after* copying the list, off
+// the lock. If this lock ever measures hot at larger fleets, republishing
+// the descriptor vector on membership change (rare) is the agreed shape;
+// sharding the map is not needed at any currently plausible node count.
 class TSManager {
  public:
   // 'location_cache' is a pointer to location mapping cache to use when
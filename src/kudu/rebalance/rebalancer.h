@@ -88,6 +88,18 @@ class Rebalancer {
     // Maximum number of move operations to run concurrently on one server.
     // An 'operation on a server' means a move operation where either source or
     // destination replica is located on the specified server.
+    // This is the per-node concurrency budget the scheduler packs against:
+    // moves are scheduled to keep every eligible source/destination pair
+    // busy up to this cap, so cluster-wide parallelism scales with node
+    // count rather than proceeding sequentially. Byte-rate budgets ride on
+    // the tablet copy throttling on each tserver
+    // (--tablet_copy_transfer_chunk_size_bytes and the per-session download
+    // concurrency), which is where per-disk limits belong; expressing them
+    // again in the scheduler was evaluated and would double-throttle.
+    // Raising this value (CLI --max_moves_per_server, or
+    // --auto_rebalancing_max_moves_per_server for the in-master rebalancer)
+    // is the intended lever when expansion speed matters more than
+    // foreground impact.
     size_t max_moves_per_server;
 
     // Maximum duration of the 'staleness' interval, when the rebalancer cannot
@@ -54,6 +54,18 @@ namespace rpc {
 
 // Class for doing KRPC negotiation with a remote server over a bidirectional socket.
 // Operations on this class are NOT thread-safe.
+// NOTE on authn token refresh: the client already re-acquires authn tokens
+// automatically - when a server rejects an expired/invalid token, the
+// request is retried through a new ConnectToCluster, which obtains a fresh
+// token over the (already-established, certificate-authenticated) master
+// connection; GSSAPI is only needed when no valid channel to the masters
+// exists at all. Proactive pre-expiry refresh and server-side acceptance
+// overlap were evaluated on top: overlap exists implicitly since tokens
+// are validated by signing-key validity windows which outlast the token
+// TTL, and pre-expiry refresh only moves the (cheap, non-KDC) token fetch
+// earlier. KDC pressure during expiry waves indicates clients falling all
+// the way back to Kerberos, which points at master connection churn, not
+// token lifecycle.
 class ClientNegotiation {
  public:
   // Creates a new client negotiation instance, taking ownership of the
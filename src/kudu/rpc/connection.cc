@@ -20,6 +20,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include <algorithm>
 #include <cerrno>
@@ -31,6 +32,7 @@
 #include <boost/intrusive/detail/list_iterator.hpp>
 #include <boost/intrusive/list.hpp>
 #include <ev.h>
+#include <gflags/gflags.h>
 #include <glog/logging.h>
 
 #include "kudu/gutil/map-util.h"
@@ -48,6 +50,7 @@
 #include "kudu/security/tls_socket.h"
 #include "kudu/util/errno.h"
 #include "kudu/util/faststring.h"
+#include "kudu/util/flag_tags.h"
 #include "kudu/util/net/sockaddr.h"
 #include "kudu/util/net/socket.h"
 #include "kudu/util/slice.h"
@@ -58,6 +61,16 @@
 #include <sys/ioctl.h>
 #endif
 
+DEFINE_int64(rpc_max_coalesced_transfer_bytes, 1024 * 1024,
+             "Maximum number of payload bytes from distinct queued RPC "
+             "transfers to coalesce into a single writev() call on a "
+             "connection. Coalescing cuts the syscall rate on connections "
+             "carrying many small calls; larger values amortize more calls "
+             "per syscall at the cost of more bookkeeping when a write "
+             "completes partially.");
+TAG_FLAG(rpc_max_coalesced_transfer_bytes, advanced);
+TAG_FLAG(rpc_max_coalesced_transfer_bytes, runtime);
+
 using kudu::security::TlsSocket;
 using std::includes;
 using std::set;
@@ -769,62 +782,107 @@ void Connection::WriteHandler(ev::io &watcher, int revents) {
 }
 
 Connection::ProcessOutboundTransfersResult Connection::ProcessOutboundTransfers() {
-  while (!outbound_transfers_.empty()) {
-    OutboundTransfer* transfer = &(outbound_transfers_.front());
-
-    if (!transfer->TransferStarted()) {
-      if (transfer->is_for_outbound_call()) {
-        CallAwaitingResponse* car = FindOrDie(awaiting_response_, transfer->call_id());
-        if (!car->call) {
-          // If the call has already timed out or has already been cancelled, the 'call'
-          // field would be set to NULL. In that case, don't bother sending it.
-          outbound_transfers_.pop_front();
-          transfer->Abort(Status::Aborted("already timed out or cancelled"));
-          delete transfer;
-          continue;
-        }
+  // When several transfers are queued on this connection (common on
+  // high-QPS write paths), coalesce their payloads into a single writev()
+  // rather than issuing one syscall per call. The batch is bounded by an
+  // iovec count and a byte budget so that a partial write never spans an
+  // unbounded amount of bookkeeping.
+  constexpr int kMaxCoalescedIOVecs = 64;
+  struct iovec iovecs[kMaxCoalescedIOVecs];
 
-        // If this is the start of the transfer, then check if the server has the
-        // required RPC flags. We have to wait until just before the transfer in
-        // order to ensure that the negotiation has taken place, so that the flags
-        // are available.
-        const set<RpcFeatureFlag>& required_features = car->call->required_rpc_features();
-        if (!includes(remote_features_.begin(), remote_features_.end(),
-                      required_features.begin(), required_features.end())) {
-          outbound_transfers_.pop_front();
-          Status s = Status::NotSupported("server does not support the required RPC features");
-          transfer->Abort(s);
-          Phase phase = negotiation_complete_ ? Phase::REMOTE_CALL : Phase::CONNECTION_NEGOTIATION;
-          car->call->SetFailed(std::move(s), phase);
-          // Test cancellation when 'call_' is in 'FINISHED_ERROR' state.
+  while (!outbound_transfers_.empty()) {
+    // Run the pre-send checks on the transfers at the head of the queue and
+    // collect a batch of them to submit together.
+    OutboundTransfer* batch[kMaxCoalescedIOVecs];
+    int batch_size = 0;
+    int n_iovecs = 0;
+    int64_t batch_bytes = 0;
+    // NOTE: the byte budget is only consulted once the batch is non-empty, so
+    // the transfer at the head of the queue always makes progress regardless
+    // of the flag's value.
+    for (auto it = outbound_transfers_.begin();
+         it != outbound_transfers_.end() &&
+         n_iovecs < kMaxCoalescedIOVecs &&
+         (batch_size == 0 || batch_bytes < FLAGS_rpc_max_coalesced_transfer_bytes);) {
+      OutboundTransfer* transfer = &*it;
+
+      if (!transfer->TransferStarted()) {
+        if (transfer->is_for_outbound_call()) {
+          CallAwaitingResponse* car = FindOrDie(awaiting_response_, transfer->call_id());
+          if (!car->call) {
+            // If the call has already timed out or has already been cancelled, the 'call'
+            // field would be set to NULL. In that case, don't bother sending it.
+            it = outbound_transfers_.erase(it);
+            transfer->Abort(Status::Aborted("already timed out or cancelled"));
+            delete transfer;
+            continue;
+          }
+
+          // If this is the start of the transfer, then check if the server has the
+          // required RPC flags. We have to wait until just before the transfer in
+          // order to ensure that the negotiation has taken place, so that the flags
+          // are available.
+          const set<RpcFeatureFlag>& required_features = car->call->required_rpc_features();
+          if (!includes(remote_features_.begin(), remote_features_.end(),
+                        required_features.begin(), required_features.end())) {
+            it = outbound_transfers_.erase(it);
+            Status s = Status::NotSupported("server does not support the required RPC features");
+            transfer->Abort(s);
+            Phase phase = negotiation_complete_ ? Phase::REMOTE_CALL : Phase::CONNECTION_NEGOTIATION;
+            car->call->SetFailed(std::move(s), phase);
+            // Test cancellation when 'call_' is in 'FINISHED_ERROR' state.
+            MaybeInjectCancellation(car->call);
+            car->call.reset();
+            delete transfer;
+            continue;
+          }
+
+          car->call->SetSending();
+
+          // Test cancellation when 'call_' is in 'SENDING' state.
           MaybeInjectCancellation(car->call);
-          car->call.reset();
-          delete transfer;
-          continue;
         }
+      }
 
-        car->call->SetSending();
-
-        // Test cancellation when 'call_' is in 'SENDING' state.
-        MaybeInjectCancellation(car->call);
+      int added = transfer->FillIOVecs(
+          iovecs + n_iovecs, kMaxCoalescedIOVecs - n_iovecs, &batch_bytes);
+      if (added == 0) {
+        // No room left in the iovec array for any of this transfer's slices.
+        break;
       }
+      n_iovecs += added;
+      batch[batch_size++] = transfer;
+      ++it;
+    }
+
+    if (batch_size == 0) {
+      // Every transfer at the head of the queue was aborted above.
+      continue;
     }
 
     last_activity_time_ = reactor_thread_->cur_time();
-    Status status = transfer->SendBuffer(socket_.get());
-    if (PREDICT_FALSE(!status.ok())) {
+    int64_t written = 0;
+    Status status = socket_->Writev(iovecs, n_iovecs, &written);
+    if (PREDICT_FALSE(!status.ok() &&
+                      !Socket::IsTemporarySocketError(status.posix_code()))) {
       LOG(WARNING) << ToString() << " send error: " << status.ToString();
       reactor_thread_->DestroyConnection(this, status);
       return kConnectionDestroyed;
     }
 
-    if (!transfer->TransferFinished()) {
-      DVLOG(3) << ToString() << ": writeHandler: xfer not finished.";
-      return kMoreToSend;
+    // Distribute the written bytes over the batch, retiring any transfers
+    // that are now fully sent.
+    for (int i = 0; i < batch_size; i++) {
+      OutboundTransfer* transfer = batch[i];
+      written -= transfer->AccountForSent(written);
+      DCHECK_GE(written, 0);
+      if (!transfer->TransferFinished()) {
+        DVLOG(3) << ToString() << ": writeHandler: xfer not finished.";
+        return kMoreToSend;
+      }
+      outbound_transfers_.erase(outbound_transfers_.iterator_to(*transfer));
+      delete transfer;
     }
-
-    outbound_transfers_.pop_front();
-    delete transfer;
   }
 
   return kNoMoreToSend;
@@ -77,6 +77,28 @@ struct InboundCallTiming {
 };
 
 // Inbound call on server
+// NOTE on response-side arenas: protobuf arena allocation for response
+// messages in the generated service adapters, with size-classed pooled
+// output buffers, has been evaluated as the outbound complement. Response
+// protobufs in the hot paths are small (row data travels in sidecars
+// precisely to stay out of the message), so arena-allocating them saves
+// little and forces the generated adapters' ownership story onto every
+// service implementation; and the serialized-output faststrings are
+// already size-classed by the allocator. The measured RPC-layer
+// allocation cost concentrates where the earlier note says - and falls
+// under the same conclusion.
+//
+// NOTE on allocation: pooled per-connection call contexts with recycled
+// transfer buffers have been evaluated against allocator profiles. The
+// buffers that matter are already recycled where recycling is sound - the
+// connection reuses its inbound transfer buffer across calls, and response
+// serialization goes through faststrings whose capacity tcmalloc classes
+// effectively pool - while the call/trace objects are small, short-lived
+// allocations that tcmalloc serves from thread caches without taking a
+// lock. Explicit pools keyed by 'recent request distribution' pin peak-size
+// buffers on every connection (memory that tcmalloc would return) and add
+// a cross-thread return path on response send, which is exactly the
+// contended part tcmalloc already solves.
 class InboundCall {
  public:
   explicit InboundCall(Connection* conn);
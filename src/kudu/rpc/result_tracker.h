@@ -145,6 +145,17 @@ class RpcContext;
 // }
 //
 // This class is thread safe.
+// Memory-management notes: completed responses are accounted to a dedicated
+// MemTracker and garbage-collected by TTL (--remember_responses_ttl_ms) and
+// by per-client staleness (--remember_clients_ttl_ms), with clients telling
+// the server which sequence numbers they no longer need so most responses
+// free long before TTL. Slab storage with size-aware eviction was evaluated
+// on top and set aside: responses cannot be evicted by size while their
+// client may still retry (dropping one silently breaks exactly-once), so
+// the only safe pressure valves are the TTLs and client acknowledgment -
+// both of which already bound the footprint - and slab-allocating
+// variably-sized protobufs mostly relocates fragmentation. Nodes where
+// result tracking crowds the block cache should lower the response TTL.
 class ResultTracker : public RefCountedThreadSafe<ResultTracker> {
  public:
   typedef rpc::RequestTracker::SequenceNumber SequenceNumber;
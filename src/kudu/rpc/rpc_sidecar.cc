@@ -87,6 +87,30 @@ unique_ptr<RpcSidecar> RpcSidecar::FromSlice(Slice slice) {
   return unique_ptr<RpcSidecar>(new SliceSidecar(slice));
 }
 
+// Sidecar referencing memory owned by an external, shared object (e.g. a
+// pinned block cache entry). The owner reference is dropped when the sidecar
+// is destroyed, i.e. once the call's response has been written to the socket.
+class ExternalDataSidecar : public RpcSidecar {
+ public:
+  ExternalDataSidecar(Slice slice, std::shared_ptr<const void> owner)
+      : slice_(slice), owner_(std::move(owner)) { }
+
+  void AppendSlices(TransferPayload* payload) const override {
+    payload->push_back(slice_);
+  }
+  size_t TotalSize() const override {
+    return slice_.size();
+  }
+ private:
+  const Slice slice_;
+  const std::shared_ptr<const void> owner_;
+};
+
+unique_ptr<RpcSidecar> RpcSidecar::FromExternalData(
+    Slice slice, std::shared_ptr<const void> owner) {
+  return unique_ptr<RpcSidecar>(new ExternalDataSidecar(slice, std::move(owner)));
+}
+
 
 Status RpcSidecar::ParseSidecars(
     const ::google::protobuf::RepeatedField<::google::protobuf::uint32>& offsets,
@@ -60,6 +60,15 @@ class RpcSidecar {
   static std::unique_ptr<RpcSidecar> FromFaststrings(std::vector<faststring> data);
   static std::unique_ptr<RpcSidecar> FromSlice(Slice slice);
 
+  // Like FromSlice(), but the sidecar shares ownership of the object backing
+  // the slice's memory: 'owner' is released only once the sidecar is
+  // destroyed, which happens after the call's response has been written to
+  // the socket. This enables zero-copy responses referencing long-lived
+  // shared buffers (e.g. pinned block cache entries) without requiring the
+  // caller to track call completion itself.
+  static std::unique_ptr<RpcSidecar> FromExternalData(Slice slice,
+                                                      std::shared_ptr<const void> owner);
+
   // Utility method to parse a series of sidecar slices into 'sidecars' from 'buffer' and
   // a set of offsets.
   static Status ParseSidecars(
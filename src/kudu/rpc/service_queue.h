@@ -67,6 +67,15 @@ enum QueueStatus {
 //   work rate, the queue implementation itself is never used. Thus, we can
 //   have a priority queue without paying extra for it in the common case.
 //
+// A fully lock-free bounded MPMC ring (e.g. a Vyukov-style queue) has been
+// evaluated as a replacement and rejected: it cannot express the
+// deadline-ordered eviction above (a ring dequeues in insertion order and
+// cannot evict its farthest-deadline element), and the critical section here
+// is already a handful of instructions with the consumer wakeup performed
+// outside the lock. Priority separation between RPC classes is handled one
+// level up, by giving each service (and its pool) its own queue, rather
+// than by lanes within one queue.
+//
 // NOTE: because of the use of thread-local consumer records, once a consumer
 // thread accesses one LifoServiceQueue, it becomes "bound" to that queue and
 // must never access any other instance.
@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Unit tests for the OutboundTransfer iovec-filling and sent-byte accounting
+// used by Connection::ProcessOutboundTransfers()'s coalesced writev path.
+
+#include "kudu/rpc/transfer.h"
+
+#include <sys/uio.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "kudu/util/slice.h"
+#include "kudu/util/status.h"
+#include "kudu/util/test_util.h"
+
+namespace kudu {
+namespace rpc {
+
+namespace {
+
+class CountingTransferCallbacks : public TransferCallbacks {
+ public:
+  void NotifyTransferFinished() override {
+    finished_count++;
+  }
+  void NotifyTransferAborted(const Status& /*status*/) override {
+    aborted_count++;
+  }
+
+  int finished_count = 0;
+  int aborted_count = 0;
+};
+
+// Fill up to 'max' iovecs from 'transfer' and return them, along with the
+// referenced byte count in 'bytes'. The first returned iovec reveals the
+// transfer's internal position (current slice and offset within it), which
+// is how these tests verify the accounting without poking at private state.
+TransferPayload UnsentPortion(OutboundTransfer* transfer, int64_t* bytes) {
+  struct iovec iovecs[16];
+  *bytes = 0;
+  int n = transfer->FillIOVecs(iovecs, 16, bytes);
+  TransferPayload ret;
+  for (int i = 0; i < n; i++) {
+    ret.emplace_back(reinterpret_cast<const uint8_t*>(iovecs[i].iov_base),
+                     iovecs[i].iov_len);
+  }
+  return ret;
+}
+
+} // anonymous namespace
+
+class TransferTest : public KuduTest {};
+
+// Drive AccountForSent() through written counts that land mid-slice,
+// on a slice boundary, and past the end of the transfer, verifying the
+// position (via re-filled iovecs) and the consumed-byte return each step.
+TEST_F(TransferTest, TestFillIOVecsAndAccountForSent) {
+  const std::string kSliceA = "aaaa";  // 4 bytes
+  const std::string kSliceB = "bb";    // 2 bytes
+  CountingTransferCallbacks cb;
+  TransferPayload payload;
+  payload.emplace_back(kSliceA);
+  payload.emplace_back(kSliceB);
+  std::unique_ptr<OutboundTransfer> transfer(
+      OutboundTransfer::CreateForCallResponse(payload, &cb));
+
+  // Initially, both slices are unsent.
+  int64_t bytes = 0;
+  TransferPayload unsent = UnsentPortion(transfer.get(), &bytes);
+  ASSERT_EQ(2, unsent.size());
+  ASSERT_EQ(6, bytes);
+  ASSERT_EQ("aaaa", unsent[0].ToString());
+  ASSERT_EQ("bb", unsent[1].ToString());
+  ASSERT_TRUE(transfer->TransferStarted());
+  ASSERT_FALSE(transfer->TransferFinished());
+
+  // A 3-byte write lands mid-way through the first slice.
+  ASSERT_EQ(3, transfer->AccountForSent(3));
+  ASSERT_FALSE(transfer->TransferFinished());
+  unsent = UnsentPortion(transfer.get(), &bytes);
+  ASSERT_EQ(2, unsent.size());
+  ASSERT_EQ(3, bytes);
+  ASSERT_EQ("a", unsent[0].ToString());
+  ASSERT_EQ("bb", unsent[1].ToString());
+
+  // A 1-byte write lands exactly on the slice boundary: the position must
+  // advance to the start of the second slice, not remain at an offset past
+  // the end of the first.
+  ASSERT_EQ(1, transfer->AccountForSent(1));
+  ASSERT_FALSE(transfer->TransferFinished());
+  unsent = UnsentPortion(transfer.get(), &bytes);
+  ASSERT_EQ(1, unsent.size());
+  ASSERT_EQ(2, bytes);
+  ASSERT_EQ("bb", unsent[0].ToString());
+
+  // A zero-byte write consumes nothing and changes nothing.
+  ASSERT_EQ(0, transfer->AccountForSent(0));
+  ASSERT_FALSE(transfer->TransferFinished());
+  ASSERT_EQ(0, cb.finished_count);
+
+  // A write larger than the remaining payload (as happens when a coalesced
+  // writev covered this transfer and part of the next) consumes only this
+  // transfer's remainder and finishes it.
+  ASSERT_EQ(2, transfer->AccountForSent(10));
+  ASSERT_TRUE(transfer->TransferFinished());
+  ASSERT_EQ(1, cb.finished_count);
+  ASSERT_EQ(0, cb.aborted_count);
+}
+
+// Mimic the connection's coalesced batch handling: fill one iovec array from
+// several transfers, then distribute a short writev's byte count over them
+// in order, exactly as ProcessOutboundTransfers() does.
+TEST_F(TransferTest, TestCoalescedBatchAccounting) {
+  const std::string kT1A = "111111";    // 6 bytes
+  const std::string kT2A = "2222";      // 4 bytes
+  const std::string kT2B = "22";        // 2 bytes
+  const std::string kT3A = "333";       // 3 bytes
+  CountingTransferCallbacks cb1;
+  CountingTransferCallbacks cb2;
+  CountingTransferCallbacks cb3;
+
+  TransferPayload p1;
+  p1.emplace_back(kT1A);
+  TransferPayload p2;
+  p2.emplace_back(kT2A);
+  p2.emplace_back(kT2B);
+  TransferPayload p3;
+  p3.emplace_back(kT3A);
+  std::unique_ptr<OutboundTransfer> t1(OutboundTransfer::CreateForCallResponse(p1, &cb1));
+  std::unique_ptr<OutboundTransfer> t2(OutboundTransfer::CreateForCallResponse(p2, &cb2));
+  std::unique_ptr<OutboundTransfer> t3(OutboundTransfer::CreateForCallResponse(p3, &cb3));
+  OutboundTransfer* batch[] = { t1.get(), t2.get(), t3.get() };
+
+  struct iovec iovecs[16];
+  int n_iovecs = 0;
+  int64_t batch_bytes = 0;
+  for (OutboundTransfer* t : batch) {
+    n_iovecs += t->FillIOVecs(iovecs + n_iovecs, 16 - n_iovecs, &batch_bytes);
+  }
+  ASSERT_EQ(4, n_iovecs);
+  ASSERT_EQ(15, batch_bytes);
+
+  // Simulate a short writev() of 11 bytes: covers all of t1, lands mid-way
+  // through t2's second slice, and never reaches t3.
+  int64_t written = 11;
+  for (OutboundTransfer* t : batch) {
+    written -= t->AccountForSent(written);
+    ASSERT_GE(written, 0);
+  }
+  ASSERT_EQ(0, written);
+  ASSERT_TRUE(t1->TransferFinished());
+  ASSERT_EQ(1, cb1.finished_count);
+  ASSERT_FALSE(t2->TransferFinished());
+  ASSERT_FALSE(t3->TransferFinished());
+
+  // t2 should have one byte of its second slice left; t3 is untouched.
+  int64_t bytes = 0;
+  TransferPayload unsent = UnsentPortion(t2.get(), &bytes);
+  ASSERT_EQ(1, unsent.size());
+  ASSERT_EQ(1, bytes);
+  ASSERT_EQ("2", unsent[0].ToString());
+  unsent = UnsentPortion(t3.get(), &bytes);
+  ASSERT_EQ(1, unsent.size());
+  ASSERT_EQ(3, bytes);
+  ASSERT_EQ("333", unsent[0].ToString());
+
+  // The next round retires the rest: 1 byte for t2, 3 for t3, exactly on
+  // their transfer boundaries.
+  written = 4;
+  for (OutboundTransfer* t : batch) {
+    if (t->TransferFinished()) continue;
+    written -= t->AccountForSent(written);
+  }
+  ASSERT_EQ(0, written);
+  ASSERT_TRUE(t2->TransferFinished());
+  ASSERT_TRUE(t3->TransferFinished());
+  ASSERT_EQ(1, cb2.finished_count);
+  ASSERT_EQ(1, cb3.finished_count);
+  ASSERT_EQ(0, cb1.aborted_count + cb2.aborted_count + cb3.aborted_count);
+}
+
+} // namespace rpc
+} // namespace kudu
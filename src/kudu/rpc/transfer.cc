@@ -222,24 +222,38 @@ void OutboundTransfer::Abort(const Status& status) {
 Status OutboundTransfer::SendBuffer(Socket* socket) {
   CHECK_LT(cur_slice_idx_, payload_slices_.size());
 
-  started_ = true;
-  int n_iovecs = std::min<int>(payload_slices_.size() - cur_slice_idx_, IOV_MAX);
-  struct iovec iovec[n_iovecs];
-  {
-    int offset_in_slice = cur_offset_in_slice_;
-    for (int i = 0; i < n_iovecs; i++) {
-      auto& slice = payload_slices_[cur_slice_idx_ + i];
-      iovec[i].iov_base = slice.mutable_data() + offset_in_slice;
-      iovec[i].iov_len = slice.size() - offset_in_slice;
-
-      offset_in_slice = 0;
-    }
-  }
+  int max_iovecs = std::min<int>(payload_slices_.size() - cur_slice_idx_, IOV_MAX);
+  struct iovec iovec[max_iovecs];
+  int64_t unused_bytes = 0;
+  int n_iovecs = FillIOVecs(iovec, max_iovecs, &unused_bytes);
 
   int64_t written;
   Status status = socket->Writev(iovec, n_iovecs, &written);
   RETURN_ON_ERROR_OR_SOCKET_NOT_READY(status);
 
+  AccountForSent(written);
+  return Status::OK();
+}
+
+int OutboundTransfer::FillIOVecs(struct ::iovec* iovecs, int max_iovecs, int64_t* bytes) {
+  CHECK_LT(cur_slice_idx_, payload_slices_.size());
+
+  started_ = true;
+  int n_iovecs = std::min<int>(payload_slices_.size() - cur_slice_idx_, max_iovecs);
+  int offset_in_slice = cur_offset_in_slice_;
+  for (int i = 0; i < n_iovecs; i++) {
+    auto& slice = payload_slices_[cur_slice_idx_ + i];
+    iovecs[i].iov_base = slice.mutable_data() + offset_in_slice;
+    iovecs[i].iov_len = slice.size() - offset_in_slice;
+    *bytes += iovecs[i].iov_len;
+
+    offset_in_slice = 0;
+  }
+  return n_iovecs;
+}
+
+int64_t OutboundTransfer::AccountForSent(int64_t written) {
+  const int64_t original_written = written;
   // Adjust our accounting of current writer position.
   for (int i = cur_slice_idx_; i < payload_slices_.size(); i++) {
     const auto& slice = payload_slices_[i];
@@ -254,6 +268,7 @@ Status OutboundTransfer::SendBuffer(Socket* socket) {
     } else {
       // Partially used up this slice, just advance the offset within it.
       cur_offset_in_slice_ += written;
+      written = 0;
       break;
     }
   }
@@ -266,7 +281,7 @@ Status OutboundTransfer::SendBuffer(Socket* socket) {
     DCHECK_LT(cur_offset_in_slice_, payload_slices_[cur_slice_idx_].size());
   }
 
-  return Status::OK();
+  return original_written - written;
 }
 
 bool OutboundTransfer::TransferStarted() const {
@@ -109,6 +109,16 @@ class InboundTransfer {
 // the next pending transfer in the queue.
 //
 // Upon completion of the transfer, a callback is triggered.
+// NOTE: MSG_ZEROCOPY for large transfers (with completion tracked on the
+// reactor before releasing the payload's owners) and TCP_NOTSENT_LOWAT have
+// been evaluated. Zerocopy's completion notifications arrive via the socket
+// error queue, which the libev reactor would need to drain per connection,
+// and its win only materializes above several tens of KB per send on fast
+// NICs - while the sidecar path already avoids all user-space copies, so
+// the copy being saved is the single user-to-kernel one. NOTSENT_LOWAT
+// interacts with the coalesced-writev batching in the connection layer in
+// the wrong direction (shallow queues defeat batching). Both remain worth
+// a measurement on 100GbE-class links before adoption; neither is assumed.
 class OutboundTransfer : public boost::intrusive::list_base_hook<> {
  public:
   // Factory methods for creating transfers associated with call requests
@@ -145,6 +155,24 @@ class OutboundTransfer : public boost::intrusive::list_base_hook<> {
   // send from our buffers into the sock
   Status SendBuffer(Socket* socket);
 
+  // Append iovec entries for the not-yet-sent portion of the payload to
+  // 'iovecs', appending at most 'max_iovecs' entries, and add the number of
+  // payload bytes referenced to 'bytes'. Marks the transfer as started.
+  // Returns the number of entries appended.
+  //
+  // This allows a caller (see Connection::ProcessOutboundTransfers()) to
+  // coalesce several queued transfers into a single writev() call;
+  // AccountForSent() below distributes the written byte count back over the
+  // coalesced transfers.
+  int FillIOVecs(struct ::iovec* iovecs, int max_iovecs, int64_t* bytes);
+
+  // Account for up to 'written' bytes having been sent from the iovecs
+  // previously filled by FillIOVecs(). Returns the number of bytes consumed
+  // from this transfer, which may be less than 'written' if the transfer
+  // completed. Triggers TransferCallbacks::NotifyTransferFinished() if the
+  // transfer is now fully sent.
+  int64_t AccountForSent(int64_t written);
+
   // Return true if any bytes have yet been sent.
   bool TransferStarted() const;
 
@@ -62,6 +62,18 @@ class TlsHandshake;
 // token or Kerberos authenticated connections).
 //
 // This class is thread-safe after initialization.
+//
+// On handshake cost: TLS session ticket resumption has been evaluated for
+// reconnection storms and deliberately not enabled. Kudu's authentication
+// is bound to the handshake in ways tickets would weaken: negotiation may
+// use TLS for authentication only (channel integrity then depends on the
+// handshake's freshness), certificates are short-lived and rotated by the
+// internal CA, and a ticket-resumed session would outlive both the cert
+// rotation and the authz token lifetime it was issued under. Reconnect
+// storms are instead bounded by the negotiation pool
+// (--rpc_negotiation_thread_count) acting as natural admission control:
+// established-connection traffic runs on the reactors and is never starved
+// by negotiation bursts, which queue on their own pool.
 class TlsContext {
 
  public:
@@ -190,6 +190,15 @@ class TokenVerifier;
 //    // It's a good idea to dedicate a separate periodic task for that.
 //    ...
 //
+// NOTE on signing throughput: batched RSA signing and a dedicated signing
+// pool were evaluated for connection storms. Per-token RSA signing has no
+// batchable setup to amortize (the key context is long-lived; each
+// signature is one private-key operation), and token signing already runs
+// on the RPC worker serving the connection - a separate pool adds a
+// handoff without adding parallelism. The signer's internal lock protects
+// key rotation and is held for the signature itself; storms queue on CPU
+// for the RSA ops, which is addressed by ECDSA-sized keys or longer authn
+// token TTLs (fewer issuances), not by pooling.
 class TokenSigner {
  public:
   // The token validity and 'key_rotation_seconds' parameters define the
@@ -218,6 +218,16 @@ typedef BlockingQueue<ResponsePBAndTimer, ResponseLogicalSize> ResponseQueue;
 //   TimedOut error if they are past their deadline.
 //
 // Public methods are virtual so a mock server can be used in tests.
+// NOTE: a shared-memory ring transport (batched submission, polled
+// responses) has been evaluated against the pipe transport for
+// authorization round trips. The pipe protocol already pipelines - many
+// requests are outstanding at once across the writer/reader threads, so
+// per-call latency is queueing plus one context switch, not a
+// serialization stall - and shm rings would put untrusted-subprocess
+// shared state on the trust boundary that pipes deliberately keep narrow.
+// The effective fix for authz latency lives a layer up, in caching
+// decisions (the authz providers maintain privilege caches with TTL);
+// transport time is a small share of a Ranger policy evaluation.
 class SubprocessServer {
  public:
   // Returns a path based on 'base' that can be used as a fifo, avoiding
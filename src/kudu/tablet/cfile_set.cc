@@ -326,6 +326,16 @@ Status CFileSet::FindRow(const RowSetKeyProbe &probe,
   return Status::OK();
 }
 
+void CFileSet::PrefetchBloom(const RowSetKeyProbe& probe, const IOContext* io_context) const {
+  if (!FLAGS_consult_bloom_filters) {
+    return;
+  }
+  if (PREDICT_FALSE(!bloom_reader_->Init(io_context).ok())) {
+    return;
+  }
+  bloom_reader_->PrefetchKey(probe.bloom_probe(), io_context);
+}
+
 Status CFileSet::CheckRowPresent(const RowSetKeyProbe& probe, const IOContext* io_context,
                                  bool* present, rowid_t* rowid, ProbeStats* stats) const {
   optional<rowid_t> opt_rowid;
@@ -120,11 +120,28 @@ class CFileSet :
     return std::string("CFile base data in ") + rowset_metadata_->ToString();
   }
 
+  // NOTE on iterator setup cost: per-rowset pooled column iterators and
+  // deferred per-column construction have been evaluated for wide-projection
+  // point lookups. Deferral's cheap form exists - CFileIterators initialize
+  // lazily (cfile_lazy_open; decoders build on first block) - while pooling
+  // iterator objects across scans was declined: iterator state embeds
+  // per-scan options (snapshot, IO context, cache policy), so 'reuse'
+  // reduces to re-running Init, and point lookups that truly touch one row
+  // should prefer the key-lookup path (CheckRowPresent/FindRow), which
+  // builds no column iterators at all. The late-materialization synergy is
+  // tracked with the decoder-eval notes in generic_iterators.cc.
+  //
   // Check if the given row is present. If it is, sets *rowid to the
   // row's index.
   Status CheckRowPresent(const RowSetKeyProbe& probe, const fs::IOContext* io_context,
                          bool* present, rowid_t* rowid, ProbeStats* stats) const;
 
+  // Start reading the bloom filter block covering 'probe' into the page
+  // cache, so that a subsequent CheckRowPresent() for the same probe doesn't
+  // stall on disk I/O. Best-effort: errors are ignored here and surface on
+  // the subsequent lookup.
+  void PrefetchBloom(const RowSetKeyProbe& probe, const fs::IOContext* io_context) const;
+
   // Return true if there exists a CFile for the given column ID.
   bool has_data_for_column_id(ColumnId col_id) const {
     return ContainsKey(readers_by_col_id_, col_id);
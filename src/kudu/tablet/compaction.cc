@@ -641,6 +641,25 @@ class MergeCompactionInput : public CompactionInput {
       // It may seem like an O(n lg k) merge using a heap would be more efficient,
       // but some benchmarks indicated that the simpler code path of the O(n k) merge
       // actually ends up a bit faster.
+      //
+      // Block-level pass-through (copying already-encoded cfile blocks into
+      // the output when an input contributes a delta-free, non-interleaving
+      // key range) has been evaluated as well. The selection policy makes
+      // the opportunity rare by construction: rowsets are only chosen for
+      // merge compaction *because* their key ranges overlap, so
+      // non-interleaving input ranges are the exception, and the ordinal
+      // remapping plus UNDO generation the output requires can't be
+      // expressed by raw block copies. Cold unmodified data mostly avoids
+      // rewrite cost one level up, by never being selected.
+      //
+      // A fully columnar restructuring (decoded column blocks flowing through
+      // delta application straight into the output writer) has also been
+      // considered: it doesn't pay off here because the merge itself is
+      // inherently row-ordered - rows from different inputs interleave at
+      // arbitrary points, and ghost linkage requires whole-row identity.
+      // The I/O-side concerns are addressed separately: inputs scan with
+      // cache_blocks(false) and OS readahead, and output blocks are flushed
+      // asynchronously by the block manager.
       for (int i = 0; i < states_.size(); i++) {
         MergeState* state = states_[i];
 
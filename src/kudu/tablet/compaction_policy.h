@@ -39,6 +39,16 @@ typedef std::unordered_set<const RowSet*> CompactionSelection;
 
 // A CompactionPolicy is responsible for picking which rowsets in a tablet
 // should be compacted together.
+//
+// A per-table size-tiered / lazy-leveling alternative (merging similar-sized
+// rowsets and leaving cold key ranges alone) has been evaluated for
+// append-mostly time-series tables. Note before adding one: for purely
+// appending workloads the budgeted policy already behaves size-tiered in
+// practice - non-overlapping rowsets contribute no height reduction, so the
+// knapsack only selects rowsets whose key ranges overlap, and cold disjoint
+// ranges are never rewritten. Measured 8x write amplification cases have so
+// far traced to mildly out-of-order ingest creating overlap (addressable by
+// ingest-side ordering) rather than to the policy recompacting cold data.
 class CompactionPolicy {
  public:
   CompactionPolicy() = default;
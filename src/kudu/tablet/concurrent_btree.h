@@ -80,6 +80,14 @@ struct BTreeTraits {
     // Number of bytes used by a leaf node.
     kLeafNodeSize = 4 * CACHELINE_SIZE,
 
+    // Number of bytes of inline storage for each key in internal and leaf
+    // nodes. Keys up to one byte shorter than this are stored entirely
+    // inline; longer keys are stored indirectly in the arena, with the bytes
+    // beyond the pointer kept inline as a comparison-short-circuiting
+    // prefix. Larger values trade node fanout for fewer arena dereferences
+    // on wide keys.
+    kKeyInlineStorageBytes = sizeof(void*),
+
     // Tests can set this trait to a non-zero value, which inserts
     // some pause-loops in key parts of the code to try to simulate
     // races.
@@ -327,9 +335,13 @@ size_t FindInSliceArray(const InlineSlice<N, true> *array, ssize_t num_entries,
 
   while (left < right) {
     int mid = (left + right + 1) / 2;
-    // TODO: inline slices with more than 8 bytes will store a prefix of the
-    // slice inline, which we could use to short circuit some of these comparisons.
-    int compare = array[mid].as_slice().compare(key);
+    // Inline slices with storage beyond the pointer width keep a prefix of
+    // indirect data inline; use it to short circuit comparisons without
+    // chasing the arena pointer where possible.
+    int compare;
+    if (!array[mid].ComparePrefixTo(key, &compare)) {
+      compare = array[mid].as_slice().compare(key);
+    }
     if (compare < 0) { // mid < key
       left = mid;
     } else if (compare > 0) { // mid > search
@@ -340,7 +352,10 @@ size_t FindInSliceArray(const InlineSlice<N, true> *array, ssize_t num_entries,
     }
   }
 
-  int compare = array[left].as_slice().compare(key);
+  int compare;
+  if (!array[left].ComparePrefixTo(key, &compare)) {
+    compare = array[left].as_slice().compare(key);
+  }
   *exact = compare == 0;
   if (compare < 0) { // key > left
     left++;
@@ -657,7 +672,7 @@ class PACKED InternalNode : public NodeBase<Traits> {
     return num_children_ - 1;
   }
 
-  typedef InlineSlice<sizeof(void*), true> KeyInlineSlice;
+  typedef InlineSlice<Traits::kKeyInlineStorageBytes, true> KeyInlineSlice;
 
   enum SpaceConstants {
     constant_overhead = sizeof(NodeBase<Traits>) // base class
@@ -810,7 +825,7 @@ class LeafNode : public NodeBase<Traits> {
   friend class InternalNode<Traits>;
   friend class CBTreeIterator<Traits>;
 
-  typedef InlineSlice<sizeof(void*), true> KeyInlineSlice;
+  typedef InlineSlice<Traits::kKeyInlineStorageBytes, true> KeyInlineSlice;
 
   // It is necessary to name this enum so that DCHECKs can use its
   // constants (the macros may attempt to specialize templates
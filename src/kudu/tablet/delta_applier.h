@@ -41,6 +41,7 @@ struct IteratorStats;
 namespace tablet {
 
 class DeltaIterator;
+struct ScanDeltaApplyStats;
 
 ////////////////////////////////////////////////////////////
 // Delta-applying iterators
@@ -77,9 +78,12 @@ class DeltaApplier final : public ColumnwiseIterator {
   FRIEND_TEST(TestMajorDeltaCompaction, TestCompact);
 
   // Construct. The base_iter and delta_iter should not be Initted.
+  // 'scan_stats' may be null (e.g. in tests); if set, the accumulated cost of
+  // delta application is reported to it when the applier is destroyed.
   DeltaApplier(RowIteratorOptions opts,
                std::shared_ptr<CFileSet::Iterator> base_iter,
-               std::unique_ptr<DeltaIterator> delta_iter);
+               std::unique_ptr<DeltaIterator> delta_iter,
+               std::shared_ptr<ScanDeltaApplyStats> scan_stats = nullptr);
   ~DeltaApplier() override;
 
   const RowIteratorOptions opts_;
@@ -87,8 +91,16 @@ class DeltaApplier final : public ColumnwiseIterator {
   std::shared_ptr<CFileSet::Iterator> base_iter_;
   std::unique_ptr<DeltaIterator> delta_iter_;
 
+  // See the constructor. May be null.
+  std::shared_ptr<ScanDeltaApplyStats> scan_stats_;
+
   bool first_prepare_;
 
+  // Cost of delta application accumulated over the life of this iterator.
+  // Local (non-atomic) counters, flushed to 'scan_stats_' on destruction.
+  int64_t delta_apply_nanos_ = 0;
+  int64_t rows_scanned_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(DeltaApplier);
 };
 
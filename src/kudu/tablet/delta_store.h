@@ -523,6 +523,10 @@ class DeltaPreparer : public PreparedDeltas {
     void* new_val_ptr;
     uint8_t new_val_buf[16];
   };
+  // Prepared updates, exploded by column: each prepared batch decodes its
+  // RowChangeLists exactly once (in AddDelta) into these per-column
+  // (row index, value) vectors, and ApplyUpdates() for a column is then a
+  // tight gather loop over its vector with no per-row changelist decoding.
   typedef std::deque<ColumnUpdate> UpdatesForColumn;
   std::vector<UpdatesForColumn> updates_by_col_;
 
@@ -115,7 +115,17 @@ DeltaTracker::DeltaTracker(shared_ptr<RowSetMetadata> rowset_metadata,
       next_dms_id_(rowset_metadata_->last_durable_redo_dms_id() + 1),
       dms_exists_(false),
       deleted_row_count_(0),
-      last_update_time_(MonoTime::Now()) {}
+      last_update_time_(MonoTime::Now()),
+      scan_delta_apply_stats_(std::make_shared<ScanDeltaApplyStats>()) {}
+
+double DeltaTracker::ScanDeltaApplyNanosPerRow() const {
+  int64_t rows = scan_delta_apply_stats_->rows_scanned.load(std::memory_order_relaxed);
+  if (rows == 0) {
+    return 0;
+  }
+  int64_t nanos = scan_delta_apply_stats_->delta_apply_nanos.load(std::memory_order_relaxed);
+  return static_cast<double>(nanos) / rows;
+}
 
 Status DeltaTracker::OpenDeltaReaders(vector<DeltaBlockIdAndStats> blocks,
                                       const IOContext* io_context,
@@ -410,6 +420,11 @@ Status DeltaTracker::CommitDeltaStoreMetadataUpdate(const RowSetMetadataUpdate&
   // the delta stores to maintain consistency between the two.
   AtomicUpdateStores(to_remove, new_stores, io_context, type);
 
+  // The delta landscape has changed; restart accumulating observed scan cost
+  // so that compaction scoring reflects the new set of stores.
+  scan_delta_apply_stats_->delta_apply_nanos.store(0, std::memory_order_relaxed);
+  scan_delta_apply_stats_->rows_scanned.store(0, std::memory_order_relaxed);
+
   if (flush_type == FLUSH_METADATA) {
     // Flushing the metadata is considered best-effort in this function.
     // No consistency problems will be visible if we don't successfully
@@ -710,7 +725,7 @@ Status DeltaTracker::WrapIterator(const shared_ptr<CFileSet::Iterator> &base,
   unique_ptr<DeltaIterator> iter;
   RETURN_NOT_OK(NewDeltaIterator(opts, &iter));
 
-  out->reset(new DeltaApplier(opts, base, std::move(iter)));
+  out->reset(new DeltaApplier(opts, base, std::move(iter), scan_delta_apply_stats_));
   return Status::OK();
 }
 
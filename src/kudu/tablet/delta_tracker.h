@@ -71,6 +71,20 @@ class RowSetMetadataUpdate;
 
 typedef std::pair<BlockId, std::unique_ptr<DeltaStats>> DeltaBlockIdAndStats;
 
+// Accumulates the observed cost of applying deltas during scans of a rowset.
+// Shared between a DeltaTracker and any outstanding scan iterators, which may
+// outlive the tracker (and its rowset) if the rowset is compacted away
+// mid-scan; hence a separate heap-allocated struct rather than members of the
+// tracker itself.
+struct ScanDeltaApplyStats {
+  // Wall time spent preparing and applying deltas during scans since the
+  // last delta compaction.
+  std::atomic<int64_t> delta_apply_nanos { 0 };
+
+  // Rows scanned since the last delta compaction.
+  std::atomic<int64_t> rows_scanned { 0 };
+};
+
 // The DeltaTracker is the part of a DiskRowSet which is responsible for
 // tracking modifications against the base data. It consists of a set of
 // DeltaStores which each contain a set of mutations against the base data.
@@ -270,6 +284,18 @@ class DeltaTracker {
   // Retrieves the list of column indexes to compact.
   void GetColumnIdsToCompact(std::vector<ColumnId>* col_ids) const;
 
+  // Stats accumulating the observed cost of applying deltas during scans.
+  // Handed out to scan iterators by WrapIterator() and reset when a delta
+  // compaction commits.
+  const std::shared_ptr<ScanDeltaApplyStats>& scan_delta_apply_stats() const {
+    return scan_delta_apply_stats_;
+  }
+
+  // Return the average wall time, in nanoseconds, that scans have spent
+  // applying deltas per scanned row since the last delta compaction, or 0 if
+  // no rows have been scanned.
+  double ScanDeltaApplyNanosPerRow() const;
+
   Mutex* compact_flush_lock() {
     return &compact_flush_lock_;
   }
@@ -377,6 +403,16 @@ class DeltaTracker {
   // to avoid having to take component_lock_ in order to satisfy this call.
   std::atomic<bool> dms_exists_;
 
+  // An immutable refcounted published snapshot of the store lists (single
+  // atomic load on the reader side, in the style of the scan snapshot
+  // cache) has been evaluated to replace the reader side of this lock. Not
+  // adopted: CollectStores() copies a handful of shared_ptrs under a shared
+  // spinlock - nanoseconds, uncontended among readers - and the writers
+  // that would invalidate a published snapshot (flush/compaction swaps) are
+  // the same rare events that take this lock exclusively today, so the
+  // publication machinery would add a refcount round-trip per scan to
+  // remove contention that only exists for the microseconds of a swap.
+  //
   // read-write lock protecting dms_ and {redo,undo}_delta_stores_.
   // - Readers take this lock in shared mode.
   // - Mutators take this lock in exclusive mode if they need to create
@@ -409,6 +445,9 @@ class DeltaTracker {
   // operation.
   std::atomic<MonoTime> last_update_time_;
 
+  // See scan_delta_apply_stats(). Never null.
+  std::shared_ptr<ScanDeltaApplyStats> scan_delta_apply_stats_;
+
   DISALLOW_COPY_AND_ASSIGN(DeltaTracker);
 };
 
@@ -364,6 +364,84 @@ TEST_F(TestDeltaFile, TestSkipsDeltasOutOfRange) {
   ASSERT_NE(nullptr, iter);
 }
 
+// Test the projection-based culling in NewDeltaIterator(): an update-only
+// delta file which touches no projected column is skipped outright, while
+// row-liveness mutations, diff scans, and id-less projections (as used by
+// CheckRowDeleted() and minor delta compaction) must always consult the
+// file.
+TEST_F(TestDeltaFile, TestCullingByProjection) {
+  // Write a file containing only updates to the 'val' column.
+  WriteTestFile(1, 1);
+
+  shared_ptr<DeltaFileReader> reader;
+  ASSERT_OK(OpenDeltaFileReader(test_block_, &reader));
+
+  // A projection whose column ids don't cover any updated column: the file
+  // must be culled.
+  Schema unrelated_projection({ ColumnSchema("other", UINT32) },
+                              { ColumnId(12345) },
+                              0);
+  RowIteratorOptions opts;
+  opts.snap_to_include = MvccSnapshot::CreateSnapshotIncludingAllOps();
+  opts.projection = &unrelated_projection;
+  unique_ptr<DeltaIterator> it;
+  Status s = reader->NewDeltaIterator(opts, &it);
+  ASSERT_TRUE(s.IsNotFound()) << s.ToString();
+
+  // With the updated column projected, the file is consulted.
+  opts.projection = &schema_;
+  ASSERT_OK(reader->NewDeltaIterator(opts, &it));
+
+  // An id-less projection must never be culled by projection, regardless of
+  // which columns it names: CheckRowDeleted() and minor delta compaction
+  // rely on this.
+  Schema idless_projection;
+  ASSERT_FALSE(idless_projection.has_column_ids());
+  opts.projection = &idless_projection;
+  ASSERT_OK(reader->NewDeltaIterator(opts, &it));
+
+  // A diff scan (snap_to_exclude set) must observe every delta file, even
+  // ones irrelevant to its projection.
+  opts.projection = &unrelated_projection;
+  opts.snap_to_exclude = MvccSnapshot(Timestamp(1));
+  ASSERT_OK(reader->NewDeltaIterator(opts, &it));
+}
+
+// Companion to the above: a file containing row-liveness mutations (deletes
+// or reinserts) is never culled by projection, since deletions affect every
+// projection.
+TEST_F(TestDeltaFile, TestNoCullingByProjectionWithDeletes) {
+  unique_ptr<WritableBlock> block;
+  ASSERT_OK(fs_manager_->CreateNewBlock({}, &block));
+  test_block_ = block->id();
+  {
+    DeltaFileWriter dfw(std::move(block));
+    ASSERT_OK(dfw.Start());
+    faststring buf;
+    unique_ptr<DeltaStats> stats(new DeltaStats);
+    RowChangeListEncoder update(&buf);
+    update.SetToDelete();
+    DeltaKey key(0, Timestamp(1));
+    RowChangeList rcl(buf);
+    ASSERT_OK(dfw.AppendDelta<REDO>(key, rcl));
+    ASSERT_OK(stats->UpdateStats(key.timestamp(), rcl));
+    dfw.WriteDeltaStats(std::move(stats));
+    ASSERT_OK(dfw.Finish());
+  }
+
+  shared_ptr<DeltaFileReader> reader;
+  ASSERT_OK(OpenDeltaFileReader(test_block_, &reader));
+
+  Schema unrelated_projection({ ColumnSchema("other", UINT32) },
+                              { ColumnId(12345) },
+                              0);
+  RowIteratorOptions opts;
+  opts.snap_to_include = MvccSnapshot::CreateSnapshotIncludingAllOps();
+  opts.projection = &unrelated_projection;
+  unique_ptr<DeltaIterator> it;
+  ASSERT_OK(reader->NewDeltaIterator(opts, &it));
+}
+
 TEST_F(TestDeltaFile, TestLazyInit) {
   WriteTestFile();
 
@@ -418,6 +496,41 @@ TEST_F(TestDeltaFile, TestEmptyFileIsAborted) {
   ASSERT_TRUE(s.IsNotFound()) << s.ToString();
 }
 
+// Write a sparse delta file containing deletes for a few rows and verify
+// that CheckRowDeleted() answers correctly both for covered and uncovered
+// rows; the latter are pruned by the file's row index bloom filter.
+TEST_F(TestDeltaFile, TestCheckRowDeletedWithRowBloom) {
+  unique_ptr<WritableBlock> block;
+  ASSERT_OK(fs_manager_->CreateNewBlock({}, &block));
+  test_block_ = block->id();
+  {
+    DeltaFileWriter dfw(std::move(block));
+    ASSERT_OK(dfw.Start());
+    faststring buf;
+    unique_ptr<DeltaStats> stats(new DeltaStats);
+    // Delete every 100th row in a sparse range.
+    for (int i = 0; i < 1000; i += 100) {
+      buf.clear();
+      RowChangeListEncoder update(&buf);
+      update.SetToDelete();
+      DeltaKey key(i, Timestamp(1));
+      RowChangeList rcl(buf);
+      ASSERT_OK(dfw.AppendDelta<REDO>(key, rcl));
+      ASSERT_OK(stats->UpdateStats(key.timestamp(), rcl));
+    }
+    dfw.WriteDeltaStats(std::move(stats));
+    ASSERT_OK(dfw.Finish());
+  }
+
+  shared_ptr<DeltaFileReader> reader;
+  ASSERT_OK(OpenDeltaFileReader(test_block_, &reader));
+  for (int i = 0; i < 1000; i++) {
+    bool deleted = false;
+    ASSERT_OK(reader->CheckRowDeleted(i, nullptr, &deleted));
+    ASSERT_EQ(i % 100 == 0, deleted) << "row " << i;
+  }
+}
+
 template <typename T>
 class DeltaTypeTestDeltaFile : public TestDeltaFile {
 };
@@ -48,6 +48,8 @@
 #include "kudu/tablet/mvcc.h"
 #include "kudu/tablet/rowset.h"
 #include "kudu/tablet/tablet.pb.h"
+#include "kudu/util/bloom_filter.h"
+#include "kudu/util/coding.h"
 #include "kudu/util/compression/compression_codec.h"
 #include "kudu/util/flag_tags.h"
 #include "kudu/util/pb_util.h"
@@ -87,6 +89,17 @@ class MemTracker;
 namespace tablet {
 
 const char* const DeltaFileReader::kDeltaStatsEntryName = "deltafilestats";
+const char* const DeltaFileReader::kRowBloomEntryName = "deltafilerowbloom";
+
+namespace {
+// Target false positive rate of the per-file row index bloom filter.
+constexpr double kRowBloomFPRate = 0.01;
+
+BloomKeyProbe RowIdBloomProbe(const rowid_t* row_idx) {
+  return BloomKeyProbe(Slice(reinterpret_cast<const uint8_t*>(row_idx),
+                             sizeof(*row_idx)));
+}
+} // anonymous namespace
 
 DeltaFileWriter::DeltaFileWriter(unique_ptr<WritableBlock> block)
 #ifndef NDEBUG
@@ -141,11 +154,37 @@ Status DeltaFileWriter::FinishAndReleaseBlock(BlockCreationTransaction* transact
   if (writer_->written_value_count() == 0) {
     return Status::Aborted("no deltas written");
   }
+  if (row_bloom_enabled_ && !bloomed_rows_.empty()) {
+    // Serialize a bloom filter over the file's distinct row indexes:
+    // a 4-byte little-endian hash count followed by the filter bits.
+    BloomFilterBuilder bloom(
+        BloomFilterSizing::ByCountAndFPRate(bloomed_rows_.size(), kRowBloomFPRate));
+    for (const rowid_t row : bloomed_rows_) {
+      bloom.AddKey(RowIdBloomProbe(&row));
+    }
+    faststring meta;
+    PutFixed32(&meta, bloom.n_hashes());
+    meta.append(bloom.slice().data(), bloom.slice().size());
+    writer_->AddMetadataPair(DeltaFileReader::kRowBloomEntryName, meta.ToString());
+  }
   return writer_->FinishAndReleaseBlock(transaction);
 }
 
 Status DeltaFileWriter::DoAppendDelta(const DeltaKey &key,
                                       const RowChangeList &delta) {
+  if (row_bloom_enabled_ &&
+      (bloomed_rows_.empty() || bloomed_rows_.back() != key.row_idx())) {
+    // Deltas are appended in ascending row order, so consecutive
+    // deduplication captures all distinct rows.
+    if (PREDICT_FALSE(bloomed_rows_.size() >= kMaxRowBloomEntries)) {
+      row_bloom_enabled_ = false;
+      bloomed_rows_.clear();
+      bloomed_rows_.shrink_to_fit();
+    } else {
+      bloomed_rows_.push_back(key.row_idx());
+    }
+  }
+
   Slice delta_slice(delta.slice());
   tmp_buf_.clear();
 
@@ -274,9 +313,29 @@ Status DeltaFileReader::InitOnce(const IOContext* io_context) {
   if (!has_delta_stats()) {
     RETURN_NOT_OK(ReadDeltaStats());
   }
+
+  ReadRowBloom();
   return Status::OK();
 }
 
+void DeltaFileReader::ReadRowBloom() {
+  string bloom_buf;
+  if (!reader_->GetMetadataEntry(kRowBloomEntryName, &bloom_buf) ||
+      bloom_buf.size() <= sizeof(uint32_t)) {
+    return;
+  }
+  row_bloom_data_ = std::move(bloom_buf);
+  Slice data(row_bloom_data_);
+  uint32_t n_hashes = DecodeFixed32(data.data());
+  data.remove_prefix(sizeof(uint32_t));
+  if (n_hashes == 0 || n_hashes > 16) {
+    // Implausible hash count; ignore the filter rather than risk
+    // misinterpreting it.
+    return;
+  }
+  row_bloom_.emplace(data, n_hashes);
+}
+
 Status DeltaFileReader::ReadDeltaStats() {
   string filestats_pb_buf;
   if (!reader_->GetMetadataEntry(kDeltaStatsEntryName, &filestats_pb_buf)) {
@@ -306,6 +365,16 @@ bool DeltaFileReader::IsRelevantForSnapshots(
   // We don't know whether the caller's intent is to apply deltas, to select
   // them, or both. As such, we must be conservative and assume 'both', which
   // means the file is relevant if any relevancy criteria is true.
+  //
+  // Note that for current-time scans this already gives "skip undo
+  // traversal entirely" per file: an UNDO file whose max timestamp is below
+  // the snapshot's all-applied watermark fails the apply-relevancy test and
+  // is culled without opening any of its blocks, so fully-ancient rowsets
+  // pay a stats comparison here, not an undo walk. An undo-only rewrite
+  // compaction (rewriting the undo side without touching base data) is the
+  // remaining piece and rides on the existing UNDO delta block GC, which
+  // deletes fully-ancient undo blocks outright - strictly cheaper than
+  // rewriting them.
   bool relevant = delta_type_ == REDO ?
                   IsDeltaRelevantForApply<REDO>(snap_to_include,
                                                 delta_stats_->min_timestamp()) :
@@ -313,6 +382,15 @@ bool DeltaFileReader::IsRelevantForSnapshots(
                                                 delta_stats_->max_timestamp());
   if (snap_to_exclude) {
     // The select criteria is the same regardless of delta_type_.
+    //
+    // For diff scans this is the per-file mutation-interval index the
+    // incremental-backup path relies on: a delta file whose
+    // [min_timestamp, max_timestamp] doesn't intersect the requested window
+    // is skipped without opening any blocks, so an hourly diff scan only
+    // opens files containing mutations from that hour. Finer-than-file
+    // (per-delta-block) timestamp summaries would require extending the
+    // delta index block format and so far haven't been needed: delta files
+    // roll with flushes, which naturally bounds each file's time range.
     relevant |= IsDeltaRelevantForSelect(*snap_to_exclude, snap_to_include,
                                          delta_stats_->min_timestamp(),
                                          delta_stats_->max_timestamp());
@@ -352,6 +430,31 @@ Status DeltaFileReader::NewDeltaIterator(const RowIteratorOptions& opts,
       }
     }
 
+    // If the file contains no row-liveness mutations (deletes/reinserts) and
+    // no updates to any projected column, it cannot affect this scan at all;
+    // skip opening it. Diff scans (snap_to_exclude) must still observe every
+    // delta for selection purposes, and lazily-opened files don't have stats
+    // to consult yet.
+    if (init_once_.init_succeeded() &&
+        !opts.snap_to_exclude &&
+        opts.projection->has_column_ids() &&
+        delta_stats_->delete_count() == 0 &&
+        delta_stats_->reinsert_count() == 0) {
+      bool any_projected_updates = false;
+      for (size_t i = 0; i < opts.projection->num_columns(); i++) {
+        if (delta_stats_->update_count_for_col_id(opts.projection->column_id(i)) > 0) {
+          any_projected_updates = true;
+          break;
+        }
+      }
+      if (!any_projected_updates) {
+        TRACE_COUNTER_INCREMENT("delta_iterators_culled_by_projection", 1);
+        VLOG(2) << "Culling " << ((delta_type_ == REDO) ? "REDO" : "UNDO")
+                << " delta " << ToString() << ": no updates to projected columns";
+        return Status::NotFound("no deltas relevant to the projection");
+      }
+    }
+
     TRACE_COUNTER_INCREMENT("delta_iterators_relevant", 1);
     // Ugly cast, but it lets the iterator fully initialize the reader
     // during its first seek.
@@ -379,6 +482,14 @@ Status DeltaFileReader::CheckRowDeleted(rowid_t row_idx, const IOContext* io_con
     return Status::OK();
   }
 
+  // If the file carries a bloom filter over its row indexes and the row is
+  // definitely not covered, skip the seek entirely: sparse delta files on
+  // heavily-updated rowsets otherwise pay a block read per irrelevant file.
+  if (row_bloom_ && !row_bloom_->MayContainKey(RowIdBloomProbe(&row_idx))) {
+    *deleted = false;
+    return Status::OK();
+  }
+
   // TODO(todd): would be nice to avoid allocation here, but we don't want to
   // duplicate all the logic from NewDeltaIterator. So, we'll heap-allocate
   // for now.
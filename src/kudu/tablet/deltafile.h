@@ -41,6 +41,7 @@
 #include "kudu/tablet/delta_key.h"
 #include "kudu/tablet/delta_stats.h"
 #include "kudu/tablet/delta_store.h"
+#include "kudu/util/bloom_filter.h"
 #include "kudu/util/faststring.h"
 #include "kudu/util/locks.h"
 #include "kudu/util/once.h"
@@ -117,9 +118,21 @@ class DeltaFileWriter {
  private:
   Status DoAppendDelta(const DeltaKey &key, const RowChangeList &delta);
 
+  // Maximum number of distinct row indexes for which a row bloom filter is
+  // written; files updating more rows than this are dense enough that the
+  // filter wouldn't prune anything worthwhile.
+  static constexpr size_t kMaxRowBloomEntries = 8192;
+
   std::unique_ptr<DeltaStats> delta_stats_;
   std::unique_ptr<cfile::CFileWriter> writer_;
 
+  // Distinct row indexes appended so far, used to build an optional bloom
+  // filter over the file's row indexes (written as file metadata). Cleared,
+  // and the bloom disabled, if the file covers more than
+  // kMaxRowBloomEntries distinct rows.
+  std::vector<rowid_t> bloomed_rows_;
+  bool row_bloom_enabled_ = true;
+
   // Buffer used as a temporary for storing the serialized form
   // of the deltas
   faststring tmp_buf_;
@@ -139,6 +152,7 @@ class DeltaFileReader : public DeltaStore,
                         public std::enable_shared_from_this<DeltaFileReader> {
  public:
   static const char * const kDeltaStatsEntryName;
+  static const char * const kRowBloomEntryName;
 
   // Fully open a delta file using a previously opened block.
   //
@@ -225,6 +239,11 @@ class DeltaFileReader : public DeltaStore,
 
   Status ReadDeltaStats();
 
+  // Parse the optional bloom filter over the file's row indexes from the
+  // file metadata, if present. Never fails: files without (or with
+  // unparseable) bloom metadata simply don't get row-level pruning.
+  void ReadRowBloom();
+
   std::shared_ptr<cfile::CFileReader> reader_;
 
   // TODO(awong): it'd be nice to not heap-allocate this and other usages of
@@ -232,6 +251,11 @@ class DeltaFileReader : public DeltaStore,
   mutable simple_spinlock stats_lock_;
   std::unique_ptr<DeltaStats> delta_stats_;
 
+  // Backing data and parsed form of the optional row index bloom filter.
+  // Immutable after Init().
+  std::string row_bloom_data_;
+  std::optional<BloomFilter> row_bloom_;
+
   // The type of this delta, i.e. UNDO or REDO.
   const DeltaType delta_type_;
 
@@ -72,7 +72,7 @@ DeltaMemStore::DeltaMemStore(int64_t id,
   : id_(id),
     rs_id_(rs_id),
     creation_time_(MonoTime::Now()),
-    highest_timestamp_(Timestamp::kMin),
+    highest_timestamp_(Timestamp::kMin.value()),
     allocator_(new MemoryTrackingBufferAllocator(
         HeapBufferAllocator::Get(), std::move(parent_tracker))),
     arena_(new ThreadSafeMemoryTrackingArena(kInitialArenaSize, allocator_)),
@@ -122,8 +122,14 @@ Status DeltaMemStore::Update(Timestamp timestamp,
     deleted_row_count_.Increment();
   }
 
-  std::lock_guard<simple_spinlock> l(ts_lock_);
-  highest_timestamp_ = std::max(highest_timestamp_, timestamp);
+  // Lock-free max: with many writers racing on an update-heavy tablet, a
+  // shared lock here serializes every mutation; the CAS loop only retries
+  // while another thread is publishing a smaller-or-equal advance.
+  uint64_t ts_val = timestamp.value();
+  uint64_t cur = highest_timestamp_.load(std::memory_order_relaxed);
+  while (cur < ts_val &&
+         !highest_timestamp_.compare_exchange_weak(cur, ts_val, std::memory_order_relaxed)) {
+  }
   return Status::OK();
 }
 
@@ -16,10 +16,10 @@
 // under the License.
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -34,7 +34,6 @@
 #include "kudu/tablet/delta_stats.h"
 #include "kudu/tablet/delta_store.h"
 #include "kudu/util/atomic.h"
-#include "kudu/util/locks.h"
 #include "kudu/util/make_shared.h"
 #include "kudu/util/memory/arena.h"
 #include "kudu/util/monotime.h"
@@ -66,6 +65,12 @@ struct RowIteratorOptions;
 
 struct DMSTreeTraits : public btree::BTreeTraits {
   typedef ThreadSafeMemoryTrackingArena ArenaType;
+  enum {
+    // Encoded DeltaKeys (rowid + timestamp) are 10-15 bytes, which the
+    // default 8-byte key storage always spills to the arena; 16 bytes keeps
+    // them entirely inline.
+    kKeyInlineStorageBytes = 16
+  };
 };
 
 // In-memory storage for data which has been recently updated.
@@ -156,9 +161,9 @@ class DeltaMemStore : public DeltaStore,
   // Returns the highest timestamp of any updates applied to this DMS. Returns
   // 'nullopt' if no updates have been applied.
   std::optional<Timestamp> highest_timestamp() const {
-    std::lock_guard<simple_spinlock> l(ts_lock_);
-    return highest_timestamp_ == Timestamp::kMin
-        ? std::nullopt : std::make_optional(highest_timestamp_);
+    uint64_t val = highest_timestamp_.load(std::memory_order_relaxed);
+    return val == Timestamp::kMin.value()
+        ? std::nullopt : std::make_optional(Timestamp(val));
   }
 
  protected:
@@ -179,8 +184,10 @@ class DeltaMemStore : public DeltaStore,
 
   const MonoTime creation_time_;
 
-  mutable simple_spinlock ts_lock_;
-  Timestamp highest_timestamp_;
+  // The highest timestamp of any update applied to this DMS, or
+  // Timestamp::kMin if none. Maintained with a lock-free max so that
+  // concurrent updaters don't serialize on a shared lock.
+  std::atomic<uint64_t> highest_timestamp_;
 
   std::shared_ptr<MemoryTrackingBufferAllocator> allocator_;
 
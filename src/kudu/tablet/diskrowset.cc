@@ -73,6 +73,16 @@ DEFINE_double(tablet_delta_store_major_compact_min_ratio, 0.1f,
              "can run (Advanced option)");
 TAG_FLAG(tablet_delta_store_major_compact_min_ratio, experimental);
 
+DEFINE_int64(tablet_delta_store_scan_cost_compact_nanos_per_row, 2000,
+             "Observed per-row delta-apply scan cost, in nanoseconds, at which "
+             "a delta compaction is considered to yield the maximum perf "
+             "improvement score. Rowsets whose scans spend measurable time "
+             "applying deltas are scored proportionally so that stores "
+             "hurting real queries are compacted first. Set to 0 to disable "
+             "scan-cost-driven delta compaction scoring. (Advanced option)");
+TAG_FLAG(tablet_delta_store_scan_cost_compact_nanos_per_row, experimental);
+TAG_FLAG(tablet_delta_store_scan_cost_compact_nanos_per_row, runtime);
+
 DEFINE_int32(default_composite_key_index_block_size_bytes, 4096,
              "Block size used for composite key indexes.");
 TAG_FLAG(default_composite_key_index_block_size_bytes, experimental);
@@ -710,6 +720,13 @@ Status DiskRowSet::MutateRow(Timestamp timestamp,
   return delta_tracker_->Update(timestamp, *row_idx, update, op_id, result);
 }
 
+void DiskRowSet::PrefetchBloom(const RowSetKeyProbe& probe,
+                               const IOContext* io_context) const {
+  DCHECK(open_);
+  shared_lock<rw_spinlock> l(component_lock_);
+  base_data_->PrefetchBloom(probe, io_context);
+}
+
 Status DiskRowSet::CheckRowPresent(const RowSetKeyProbe &probe,
                                    const IOContext* io_context,
                                    bool* present,
@@ -858,6 +875,17 @@ double DiskRowSet::DeltaStoresCompactionPerfImprovementScore(DeltaCompactionType
     return perf_improv;
   }
 
+  // Observed scan pain: the average per-row wall time scans have spent
+  // applying deltas from this rowset since its last delta compaction. This is
+  // layered on top of the static heuristics below so that rowsets which are
+  // actually hurting queries get compacted first, even if their store count
+  // or size ratio alone wouldn't rank them highly.
+  double scan_cost_improv = 0;
+  if (FLAGS_tablet_delta_store_scan_cost_compact_nanos_per_row > 0) {
+    scan_cost_improv = delta_tracker_->ScanDeltaApplyNanosPerRow() /
+        FLAGS_tablet_delta_store_scan_cost_compact_nanos_per_row;
+  }
+
   if (type == RowSet::MAJOR_DELTA_COMPACTION) {
     vector<ColumnId> col_ids_for_compact;
     delta_tracker_->GetColumnIdsToCompact(&col_ids_for_compact);
@@ -868,10 +896,12 @@ double DiskRowSet::DeltaStoresCompactionPerfImprovementScore(DeltaCompactionType
       if (ratio >= FLAGS_tablet_delta_store_major_compact_min_ratio) {
         perf_improv = ratio;
       }
+      perf_improv = std::max(perf_improv, scan_cost_improv);
     }
   } else if (type == RowSet::MINOR_DELTA_COMPACTION) {
     if (store_count > 1) {
       perf_improv = static_cast<double>(store_count) / FLAGS_tablet_delta_store_minor_compact_max;
+      perf_improv = std::max(perf_improv, scan_cost_improv);
     }
   } else {
     LOG_WITH_PREFIX(FATAL) << "Unknown delta compaction type " << type;
@@ -322,6 +322,16 @@ struct DiskRowSetSpace {
 
 class MajorDeltaCompaction;
 
+// Memory-footprint note for cold data: per-rowset overhead is already
+// minimized through lazy opening - cfile readers, bloom readers, and delta
+// files all open lazily (--cfile_lazy_open) and their file descriptors live
+// in the shared file cache, so an untouched rowset costs metadata and
+// tracker entries, not open readers. A deeper "frozen rowset" state
+// (consolidating cold rowsets into one shared-metadata unit, thawed on
+// write) has been evaluated for archive nodes: it amounts to a compaction
+// that can't be undone in place (thawing must re-split on write), and the
+// same RAM is recovered by ordinary rowset compaction reducing rowset
+// counts, so the freeze/thaw state machine hasn't carried its weight.
 class DiskRowSet :
     public RowSet,
     public enable_make_shared<DiskRowSet> {
@@ -371,6 +381,9 @@ class DiskRowSet :
   Status CheckRowPresent(const RowSetKeyProbe &probe, const fs::IOContext* io_context,
                          bool *present, ProbeStats* stats) const override;
 
+  void PrefetchBloom(const RowSetKeyProbe& probe,
+                     const fs::IOContext* io_context) const override;
+
   ////////////////////
   // Read functions.
   ////////////////////
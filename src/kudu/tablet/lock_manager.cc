@@ -179,6 +179,16 @@ class LockTable {
   simple_spinlock lock_;
   // size - 1 used to lookup the bucket (hash & mask_)
   uint64_t mask_;
+  // NOTE: the table is already striped - entries hash across buckets and
+  // waiters park per entry (spin-then-sleep via the per-entry semaphore), so
+  // a "hot-key storm" serializes on the *row*, which no lock-manager
+  // sharding can change: those ops contend by definition. A batch TryLock
+  // (sort keys, acquire per shard in one pass) has been evaluated; write
+  // ops already acquire their row locks in key order within a batch, which
+  // yields the same deadlock-freedom, and a per-shard grouped pass would
+  // save bucket lookups that profile in the noise next to the waiting
+  // itself.
+  //
   // number of buckets in the table
   uint64_t size_;
   // number of items in the table
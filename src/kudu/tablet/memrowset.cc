@@ -431,6 +431,16 @@ MemRowSet::Iterator::Iterator(const std::shared_ptr<const MemRowSet>& mrs,
       delta_projector_(&mrs->schema_nonvirtual(), opts_.projection),
       projection_vc_is_deleted_idx_(opts_.projection->first_is_deleted_virtual_column_idx()),
       state_(kUninitialized) {
+  // The commit status of the MRS's transaction (if any) is invariant for the
+  // life of the iterator, so compute it once up front: consulting TxnMetadata
+  // acquires its lock, and doing so per row showed up prominently in profiles
+  // of scans over transactional MRSs.
+  const auto& txn_meta = memrowset_->txn_metadata();
+  if (txn_meta) {
+    txn_committed_in_snap_to_include_ = opts_.snap_to_include.IsCommitted(*txn_meta);
+    txn_committed_in_snap_to_exclude_ = opts_.snap_to_exclude &&
+        opts_.snap_to_exclude->IsCommitted(*txn_meta);
+  }
   // TODO(todd): various code assumes that a newly constructed iterator
   // is pointed at the beginning of the dataset. This causes a redundant
   // seek. Could make this lazy instead, or change the semantics so that
@@ -446,6 +456,16 @@ Status MemRowSet::Iterator::Init(ScanSpec *spec) {
   RETURN_NOT_OK(projector_->Init());
   RETURN_NOT_OK(delta_projector_.Init());
 
+  // If this is a transactional MRS whose transaction's commit is visible in
+  // neither snapshot, every row would be omitted in FetchRows(); skip walking
+  // the tree entirely.
+  if (memrowset_->txn_metadata() &&
+      !txn_committed_in_snap_to_include_ &&
+      !txn_committed_in_snap_to_exclude_) {
+    state_ = kFinished;
+    return Status::OK();
+  }
+
   if (spec && spec->lower_bound_key()) {
     bool exact;
     const Slice &lower_bound = spec->lower_bound_key()->encoded_key();
@@ -552,17 +572,15 @@ Status MemRowSet::Iterator::FetchRows(RowBlock* dst, size_t* fetched) {
     // range (i.e. the insert was "excluded").  However, subsequent mutations
     // may be inside the time range, so we must still project the row and walk
     // its mutation list.
-    const auto& txn_meta = memrowset_->txn_metadata();
+    const bool is_txn_mrs = memrowset_->txn_metadata() != nullptr;
     bool insert_excluded = opts_.snap_to_exclude &&
-        // TODO(awong): if we find this to be too slow, we should be able to
-        // compute IsCommitted() once per iterator at construction time.
-        (txn_meta ? opts_.snap_to_exclude->IsCommitted(*txn_meta.get()) :
-                    opts_.snap_to_exclude->IsApplied(row.insertion_timestamp()));
+        (is_txn_mrs ? txn_committed_in_snap_to_exclude_ :
+                      opts_.snap_to_exclude->IsApplied(row.insertion_timestamp()));
     bool unset_in_sel_vector;
     ApplyStatus apply_status;
     if (insert_excluded ||
-        (txn_meta ? opts_.snap_to_include.IsCommitted(*txn_meta.get()) :
-                    opts_.snap_to_include.IsApplied(row.insertion_timestamp()))) {
+        (is_txn_mrs ? txn_committed_in_snap_to_include_ :
+                      opts_.snap_to_include.IsApplied(row.insertion_timestamp()))) {
       RETURN_NOT_OK(projector_->ProjectRowForRead(row, &dst_row, dst->arena()));
 
       // Roll-forward MVCC for committed updates.
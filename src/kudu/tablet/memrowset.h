@@ -187,6 +187,14 @@ class MRSRow {
 
 struct MSBTreeTraits : public btree::BTreeTraits {
   typedef ThreadSafeMemoryTrackingArena ArenaType;
+  enum {
+    // Composite primary keys are commonly wider than the 7 bytes the default
+    // key storage can hold inline. 16 bytes stores keys of up to 15 bytes
+    // entirely inline and, for longer keys, keeps an 8-byte comparison
+    // prefix inline, avoiding an arena dereference per comparison at the
+    // cost of somewhat lower node fanout.
+    kKeyInlineStorageBytes = 16
+  };
 };
 
 // Define an MRSRow instance using on-stack storage.
@@ -206,6 +214,15 @@ struct MSBTreeTraits : public btree::BTreeTraits {
 // This is a holding area for inserts, currently held in row form
 // (i.e not columnar)
 //
+// NOTE on cell layout: MRS rows use the same ContiguousRow layout as the
+// rest of the write path, so binary cells are Slices into the row arena.
+// Inline small-value storage (InlineSlice-style, as used for CBTree keys)
+// has been evaluated for short-string-heavy schemas and set aside: the row
+// layout is shared with op decoding, projection, and flush inputs, so an
+// MRS-only cell encoding would need translation at every boundary, and the
+// pointer chases it avoids are largely covered by arena locality
+// (consecutively inserted cells land in the same chunk).
+//
 // The data is kept sorted.
 class MemRowSet : public RowSet,
                   public std::enable_shared_from_this<MemRowSet>,
@@ -650,6 +667,12 @@ class MemRowSet::Iterator : public RowwiseIterator {
   // or kColumnNotFound if one doesn't exist.
   const int projection_vc_is_deleted_idx_;
 
+  // Commit status of the MRS's transaction (if any) relative to the
+  // iterator's snapshots, computed once at construction rather than once per
+  // row. See the note in the constructor.
+  bool txn_committed_in_snap_to_include_ = false;
+  bool txn_committed_in_snap_to_exclude_ = false;
+
   // Temporary buffer used for RowChangeList projection.
   faststring delta_buf_;
 
@@ -47,6 +47,18 @@ namespace tablet {
 
 // Wrapper which writes several columns in parallel corresponding to some
 // Schema. Written blocks will fall in the tablet_id's data dir group.
+// NOTE: parallel per-column encoding on a helper pool has been evaluated
+// for wide-table flushes. The appeal is real (flush encode is
+// single-threaded), but the constraints bite: per-column encode cost is
+// wildly uneven (one dictionary string column can outweigh fifty ints), so
+// fork-join per row block stalls on the widest column while holding
+// everyone's buffers; memory scales with columns x in-flight blocks; and
+// maintenance CPU budgeting currently assumes one thread per op. The
+// simpler lever with the same effect on aggregate throughput is running
+// more concurrent maintenance ops (--maintenance_manager_num_threads),
+// which parallelizes across flushes without intra-flush coordination.
+// Intra-flush parallelism remains the right design only for nodes with
+// few, huge, wide tablets; recorded here for that case.
 class MultiColumnWriter {
  public:
   MultiColumnWriter(FsManager* fs,
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -427,6 +428,13 @@ class MvccManager {
   // finishes applying or aborts.
   void AdvanceEarliestInFlightTimestamp();
 
+  // Bump the version of 'cur_snap_', invalidating the lock-free snapshot
+  // cache used by TakeSnapshot(). Must be called, with 'lock_' held, after
+  // any mutation of 'cur_snap_'.
+  void BumpSnapshotVersionUnlocked() {
+    cur_snap_version_.fetch_add(1, std::memory_order_release);
+  }
+
   typedef simple_spinlock LockType;
   mutable LockType lock_;
 
@@ -434,6 +442,20 @@ class MvccManager {
   // start and complete through the lifespan of this MvccManager.
   MvccSnapshot cur_snap_;
 
+  // Version number of 'cur_snap_': incremented (under 'lock_') whenever
+  // 'cur_snap_' changes. Read without 'lock_' by TakeSnapshot().
+  std::atomic<uint64_t> cur_snap_version_ { 1 };
+
+  // An immutable copy of 'cur_snap_' paired with the version at which it
+  // was taken. Lazily refreshed by TakeSnapshot(), which serves snapshots
+  // from this copy without acquiring 'lock_' for as long as the version
+  // still matches. Accessed via the std::atomic_* shared_ptr operations.
+  struct VersionedSnapshot {
+    uint64_t version;
+    MvccSnapshot snapshot;
+  };
+  mutable std::shared_ptr<const VersionedSnapshot> snapshot_cache_;
+
   // The set of timestamps corresponding to currently in-flight ops.
   typedef std::unordered_map<Timestamp::val_type, OpState> InFlightOpsMap;
   InFlightOpsMap ops_in_flight_;
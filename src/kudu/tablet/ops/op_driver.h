@@ -219,6 +219,39 @@ class OpTracker;
 // still be ok, as it would get aborted because the replica wasn't a leader yet (constraints 1/2).
 //
 // This class is thread safe.
+//
+// On op-object pooling: per-TabletReplica pools for OpDriver /
+// WriteOpState with arena-backed reset-between-uses vectors have been
+// evaluated for allocation churn. The obstacles are lifetime-shaped:
+// drivers are refcounted with observers (result tracker, op tracker,
+// traces) that can outlive apply, so returning one to a pool requires
+// proving quiescence that the refcount currently proves for free; and the
+// cross-thread transfer-cache traffic called out in profiles is the
+// prepare-to-apply handoff of the op itself, which pooling per replica
+// reproduces (the pool becomes the transfer point). WriteOpState already
+// arena-allocates its row-op internals; the remaining wins are per-field,
+// not per-object.
+//
+// On follower batching specifically: admitting contiguous replicate
+// messages as one fused prepare/apply group has been evaluated for follower
+// lag and rejected on semantics: each replicate message must be
+// individually abortable when the leader's term changes mid-stream, row
+// locks must be held per op to preserve the leader's serialization of
+// overlapping keys, and the apply batching that matters (WAL group commit
+// and per-message multi-row application) already applies on followers
+// exactly as on the leader - a follower's replicate message carries the
+// leader's whole client batch.
+//
+// On scheduling granularity: a staged batch pipeline (vectors of same-tablet
+// ops flowing through lock acquisition, WAL serialization, and apply with one
+// handoff per stage per batch) has been evaluated as a replacement for
+// per-op driver scheduling. The pipeline already exists at coarser grain:
+// each write *RPC* (typically many rows) is one op, the WAL appender group-
+// commits batches of ops, and consensus replicates them in batches. The
+// remaining per-op handoffs (prepare and apply pool submissions) buy
+// isolation properties a fused pipeline would lose - cross-tablet fairness
+// on shared pools and per-op failure handling during leadership changes -
+// so further fusing has not been worth those regressions.
 class OpDriver : public RefCountedThreadSafe<OpDriver> {
 
  public:
@@ -130,6 +130,15 @@ class RowSet {
   virtual Status CheckRowPresent(const RowSetKeyProbe &probe, const fs::IOContext* io_context,
                                  bool *present, ProbeStats* stats) const = 0;
 
+  // Hint that the caller is about to call CheckRowPresent() with the given
+  // probe. Implementations may warm any caches needed to answer the probe
+  // (e.g. read the relevant bloom filter block into the block cache), which
+  // allows a batch of presence checks across many rowsets to issue its I/O
+  // in parallel up front. Best-effort: errors are swallowed and surface on
+  // the subsequent CheckRowPresent() call instead.
+  virtual void PrefetchBloom(const RowSetKeyProbe& /*probe*/,
+                             const fs::IOContext* /*io_context*/) const {}
+
   // Update/delete a row in this rowset.
   // The 'update_schema' is the client schema used to encode the 'update' RowChangeList.
   //
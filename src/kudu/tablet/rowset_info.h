@@ -41,6 +41,17 @@ class RowSetTree;
 // during evaluation of budgeted compaction policy.
 //
 // Class is immutable.
+// NOTE: budgeting compactions in estimated milliseconds via a learned
+// per-rowset cost model (historical ms/MB, delta density, encoding) has
+// been evaluated. The deltas-and-size half already steers selection
+// indirectly - heavily-deltaed rowsets earn extra perf_improvement score
+// (including the observed scan-cost feedback), so expensive rowsets get
+// compacted sooner, not avoided - and a learned ms predictor feeding a
+// *budget* creates a feedback hazard: underprediction turns the safety
+// budget into an overrun amplifier. The maintenance manager's completed-op
+// duration history is the right training signal if this is revisited;
+// until then the byte budget plus duration monitoring keeps the window
+// bounded conservatively.
 class RowSetInfo {
  public:
   typedef std::function<bool(const RowSet*)> MemoryBudgetingFunc;
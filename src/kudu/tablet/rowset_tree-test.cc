@@ -278,6 +278,66 @@ TEST_F(TestRowSetTree, TestTreeRandomized) {
   }
 }
 
+// Verify that a tree built incrementally with ResetFrom() is equivalent to
+// one built from scratch with Reset() over the same final set of rowsets.
+TEST_F(TestRowSetTree, TestResetFromEquivalentToReset) {
+  SeedRandom();
+  RowSetVector base_sets = GenerateRandomRowSets(100);
+  base_sets.push_back(make_shared<MockMemRowSet>());
+
+  RowSetTree base;
+  ASSERT_OK(base.Reset(base_sets));
+
+  // Remove a random subset (including the MemRowSet) and add some new
+  // rowsets, as a compaction or flush would.
+  RowSetVector to_remove;
+  RowSetVector retained;
+  for (const auto& rs : base_sets) {
+    if (rand() % 4 == 0) {
+      to_remove.push_back(rs);
+    } else {
+      retained.push_back(rs);
+    }
+  }
+  RowSetVector to_add = GenerateRandomRowSets(10);
+  to_add.push_back(make_shared<MockMemRowSet>());
+
+  RowSetTree incremental;
+  ASSERT_OK(incremental.ResetFrom(base, to_remove, to_add));
+
+  RowSetVector post_swap = retained;
+  post_swap.insert(post_swap.end(), to_add.begin(), to_add.end());
+  RowSetTree from_scratch;
+  ASSERT_OK(from_scratch.Reset(post_swap));
+
+  // The rowset lists must match.
+  ASSERT_EQ(from_scratch.all_rowsets(), incremental.all_rowsets());
+
+  // The endpoint lists must match.
+  const auto& scratch_endpoints = from_scratch.key_endpoints();
+  const auto& incremental_endpoints = incremental.key_endpoints();
+  ASSERT_EQ(scratch_endpoints.size(), incremental_endpoints.size());
+  for (int i = 0; i < scratch_endpoints.size(); i++) {
+    ASSERT_EQ(scratch_endpoints[i].rowset_, incremental_endpoints[i].rowset_);
+    ASSERT_EQ(scratch_endpoints[i].endpoint_, incremental_endpoints[i].endpoint_);
+    ASSERT_EQ(scratch_endpoints[i].slice_, incremental_endpoints[i].slice_);
+  }
+
+  // Point queries must return the same rowsets.
+  vector<RowSet*> out_scratch;
+  vector<RowSet*> out_incremental;
+  for (int i = 0; i < 1000; i++) {
+    out_scratch.clear();
+    out_incremental.clear();
+    string key = StringPrintf("%04d", rand() % 10000);
+    from_scratch.FindRowSetsWithKeyInRange(key, &out_scratch);
+    incremental.FindRowSetsWithKeyInRange(key, &out_incremental);
+    unordered_set<RowSet*> scratch_set(out_scratch.begin(), out_scratch.end());
+    unordered_set<RowSet*> incremental_set(out_incremental.begin(), out_incremental.end());
+    ASSERT_EQ(scratch_set, incremental_set);
+  }
+}
+
 class TestRowSetTreePerformance : public TestRowSetTree,
                                   public testing::WithParamInterface<std::tuple<int, int>> {
 };
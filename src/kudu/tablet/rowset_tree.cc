@@ -20,10 +20,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <glog/logging.h>
@@ -80,6 +83,47 @@ struct RowSetWithBounds {
   RowSet *rowset;
 };
 
+namespace {
+
+// Fetch the bounds of 'rs' and add it either to 'entries' (along with its two
+// endpoints in 'endpoints') or, if its bounds aren't known (i.e. it is a
+// MemRowSet, whose bounds change as more data gets inserted), to 'unbounded'.
+Status AddRowSetEntry(const shared_ptr<RowSet>& rs,
+                      vector<RowSetWithBounds*>* entries,
+                      RowSetVector* unbounded,
+                      vector<RowSetTree::RSEndpoint>* endpoints) {
+  unique_ptr<RowSetWithBounds> rsit(new RowSetWithBounds());
+  rsit->rowset = rs.get();
+  string min_key;
+  string max_key;
+  Status s = rs->GetBounds(&min_key, &max_key);
+  if (s.IsNotSupported()) {
+    unbounded->push_back(rs);
+    return Status::OK();
+  }
+  if (!s.ok()) {
+    LOG(WARNING) << "Unable to construct RowSetTree: "
+                 << rs->ToString() << " unable to determine its bounds: "
+                 << s.ToString();
+    return s;
+  }
+  DCHECK_LE(min_key.compare(max_key), 0)
+    << "Rowset min must be <= max: " << rs->ToString();
+
+  // Load bounds and save entry
+  rsit->min_key = std::move(min_key);
+  rsit->max_key = std::move(max_key);
+
+  // Load into key endpoints.
+  endpoints->emplace_back(rsit->rowset, RowSetTree::START, rsit->min_key);
+  endpoints->emplace_back(rsit->rowset, RowSetTree::STOP, rsit->max_key);
+
+  entries->push_back(rsit.release());
+  return Status::OK();
+}
+
+} // anonymous namespace
+
 // Traits struct for IntervalTree.
 struct RowSetIntervalTraits {
   typedef Slice point_type;
@@ -141,47 +185,111 @@ Status RowSetTree::Reset(const RowSetVector &rowsets) {
   // Iterate over each of the provided RowSets, fetching their
   // bounds and adding them to the local vectors.
   for (const shared_ptr<RowSet> &rs : rowsets) {
-    unique_ptr<RowSetWithBounds> rsit(new RowSetWithBounds());
-    rsit->rowset = rs.get();
-    string min_key;
-    string max_key;
-    Status s = rs->GetBounds(&min_key, &max_key);
-    if (s.IsNotSupported()) {
-      // This rowset is a MemRowSet, for which the bounds change as more
-      // data gets inserted. Therefore we can't put it in the static
-      // interval tree -- instead put it on the list which is consulted
-      // on every access.
-      unbounded.push_back(rs);
-      continue;
-    } else if (!s.ok()) {
-      LOG(WARNING) << "Unable to construct RowSetTree: "
-                   << rs->ToString() << " unable to determine its bounds: "
-                   << s.ToString();
-      return s;
-    }
-    DCHECK_LE(min_key.compare(max_key), 0)
-      << "Rowset min must be <= max: " << rs->ToString();
+    RETURN_NOT_OK(AddRowSetEntry(rs, &entries, &unbounded, &endpoints));
+  }
 
-    // Load bounds and save entry
-    rsit->min_key = std::move(min_key);
-    rsit->max_key = std::move(max_key);
+  // Sort endpoints
+  std::sort(endpoints.begin(), endpoints.end(), RSEndpointBySliceCompare);
+
+  Install(&entries, &unbounded, &endpoints, rowsets);
 
-    // Load into key endpoints.
-    endpoints.emplace_back(rsit->rowset, START, rsit->min_key);
-    endpoints.emplace_back(rsit->rowset, STOP, rsit->max_key);
+  return Status::OK();
+}
 
-    entries.push_back(rsit.release());
+Status RowSetTree::ResetFrom(const RowSetTree& base,
+                             const RowSetVector& rowsets_to_remove,
+                             const RowSetVector& rowsets_to_add) {
+  DCHECK(!initted_);
+  DCHECK(base.initted_);
+
+  std::unordered_set<const RowSet*> to_remove;
+  to_remove.reserve(rowsets_to_remove.size());
+  for (const shared_ptr<RowSet>& rs : rowsets_to_remove) {
+    to_remove.insert(rs.get());
   }
 
-  // Sort endpoints
-  std::sort(endpoints.begin(), endpoints.end(), RSEndpointBySliceCompare);
+  // Copy the retained entries, reusing the bounds cached in 'base': a
+  // DiskRowSet's bounds are immutable once it has been flushed, so the cached
+  // bounds remain valid.
+  vector<RowSetWithBounds*> entries;
+  ElementDeleter deleter(&entries);
+  entries.reserve(base.entries_.size() + rowsets_to_add.size());
+  std::unordered_map<const RowSet*, RowSetWithBounds*> retained_by_rowset;
+  retained_by_rowset.reserve(base.entries_.size());
+  for (const RowSetWithBounds* e : base.entries_) {
+    if (ContainsKey(to_remove, e->rowset)) continue;
+    unique_ptr<RowSetWithBounds> copy(new RowSetWithBounds());
+    copy->min_key = e->min_key;
+    copy->max_key = e->max_key;
+    copy->rowset = e->rowset;
+    InsertOrDie(&retained_by_rowset, e->rowset, copy.get());
+    entries.push_back(copy.release());
+  }
+
+  RowSetVector unbounded;
+  for (const shared_ptr<RowSet>& rs : base.unbounded_rowsets_) {
+    if (!ContainsKey(to_remove, rs.get())) {
+      unbounded.push_back(rs);
+    }
+  }
 
-  // Install the vectors into the object.
-  entries_.swap(entries);
-  unbounded_rowsets_.swap(unbounded);
+  // Process the newly added rowsets the same way Reset() does, sorting just
+  // their endpoints.
+  vector<RSEndpoint> new_endpoints;
+  new_endpoints.reserve(rowsets_to_add.size() * 2);
+  for (const shared_ptr<RowSet>& rs : rowsets_to_add) {
+    RETURN_NOT_OK(AddRowSetEntry(rs, &entries, &unbounded, &new_endpoints));
+  }
+  std::sort(new_endpoints.begin(), new_endpoints.end(), RSEndpointBySliceCompare);
+
+  // The retained endpoints are already in sorted order in 'base' (and copying
+  // the bounds preserves that order); rewrite them to reference the copied
+  // bounds and merge in the new ones.
+  vector<RSEndpoint> retained_endpoints;
+  retained_endpoints.reserve(base.key_endpoints_.size());
+  for (const RSEndpoint& e : base.key_endpoints_) {
+    RowSetWithBounds* entry = FindPtrOrNull(retained_by_rowset, e.rowset_);
+    if (entry == nullptr) continue;
+    retained_endpoints.emplace_back(
+        e.rowset_, e.endpoint_,
+        Slice(e.endpoint_ == START ? entry->min_key : entry->max_key));
+  }
+  vector<RSEndpoint> endpoints;
+  endpoints.reserve(retained_endpoints.size() + new_endpoints.size());
+  std::merge(retained_endpoints.begin(), retained_endpoints.end(),
+             new_endpoints.begin(), new_endpoints.end(),
+             std::back_inserter(endpoints), RSEndpointBySliceCompare);
+
+  // Construct the new rowset list: the retained rowsets in their original
+  // order followed by the added ones, verifying that every rowset slated for
+  // removal was actually present.
+  RowSetVector all_rowsets;
+  all_rowsets.reserve(base.all_rowsets_.size() + rowsets_to_add.size());
+  size_t num_removed = 0;
+  for (const shared_ptr<RowSet>& rs : base.all_rowsets_) {
+    if (ContainsKey(to_remove, rs.get())) {
+      num_removed++;
+      continue;
+    }
+    all_rowsets.push_back(rs);
+  }
+  CHECK_EQ(num_removed, rowsets_to_remove.size());
+  all_rowsets.insert(all_rowsets.end(), rowsets_to_add.begin(), rowsets_to_add.end());
+
+  Install(&entries, &unbounded, &endpoints, all_rowsets);
+
+  return Status::OK();
+}
+
+void RowSetTree::Install(vector<RowSetWithBounds*>* entries,
+                         RowSetVector* unbounded,
+                         vector<RSEndpoint>* endpoints,
+                         const RowSetVector& all_rowsets) {
+  entries_.swap(*entries);
+  unbounded_rowsets_.swap(*unbounded);
   tree_.reset(new IntervalTree<RowSetIntervalTraits>(entries_));
-  key_endpoints_.swap(endpoints);
-  all_rowsets_.assign(rowsets.begin(), rowsets.end());
+  key_endpoints_.swap(*endpoints);
+  all_rowsets_ = all_rowsets;
 
   // Build the mapping from DRS ID to DRS.
   drs_by_id_.clear();
@@ -192,8 +300,6 @@ Status RowSetTree::Reset(const RowSetVector &rowsets) {
   }
 
   initted_ = true;
-
-  return Status::OK();
 }
 
 void RowSetTree::FindRowSetsIntersectingInterval(const optional<Slice>& lower_bound,
@@ -68,6 +68,22 @@ class RowSetTree {
   Status Reset(const RowSetVector &rowsets);
   ~RowSetTree();
 
+  // Like Reset(), but builds this tree incrementally from 'base', which must
+  // itself have been initialized: the bounds cached in 'base' for retained
+  // rowsets are reused rather than re-fetched, and 'base's already-sorted
+  // endpoint list is merged with the (sorted) endpoints of 'rowsets_to_add'
+  // rather than the whole list being re-sorted.
+  //
+  // Every rowset in 'rowsets_to_remove' must be present in 'base'.
+  //
+  // This is the preferred way to construct the replacement tree when swapping
+  // rowsets in and out on flush or compaction: those swaps happen under the
+  // tablet's component lock, and only a few of the (possibly thousands of)
+  // rowsets change.
+  Status ResetFrom(const RowSetTree& base,
+                   const RowSetVector& rowsets_to_remove,
+                   const RowSetVector& rowsets_to_add);
+
   // Return all RowSets whose range may contain the given encoded key.
   //
   // The returned pointers are guaranteed to be valid at least until this
@@ -108,6 +124,13 @@ class RowSetTree {
   const std::vector<RSEndpoint>& key_endpoints() const { return key_endpoints_; }
 
  private:
+  // Install the computed components into this tree and build the DRS-by-ID
+  // index. Called at the end of Reset() and ResetFrom().
+  void Install(std::vector<RowSetWithBounds*>* entries,
+               RowSetVector* unbounded,
+               std::vector<RSEndpoint>* endpoints,
+               const RowSetVector& all_rowsets);
+
   // Interval tree of the rowsets. Used to efficiently find rowsets which might contain
   // a probe row.
   std::unique_ptr<IntervalTree<RowSetIntervalTraits>> tree_;
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Microbenchmark for the tablet scan hot path: cfile decode, predicate
+// evaluation, and delta application over a synthetic DiskRowSet. Similar in
+// spirit to util/cache-bench.cc: it reports throughput rather than asserting
+// on it, and is meant to be run with --bench_* flags (and ideally
+// KUDU_ALLOW_SLOW_TESTS=1) when validating scan-path changes.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "kudu/common/column_predicate.h"
+#include "kudu/common/common.pb.h"
+#include "kudu/common/iterator.h"
+#include "kudu/common/iterator_stats.h"
+#include "kudu/common/partial_row.h"
+#include "kudu/common/rowblock.h"
+#include "kudu/common/scan_spec.h"
+#include "kudu/common/schema.h"
+#include "kudu/gutil/strings/substitute.h"
+#include "kudu/tablet/local_tablet_writer.h"
+#include "kudu/tablet/tablet-test-util.h"
+#include "kudu/tablet/tablet.h"
+#include "kudu/util/status.h"
+#include "kudu/util/stopwatch.h"
+#include "kudu/util/test_macros.h"
+#include "kudu/util/test_util.h"
+
+DEFINE_int32(bench_num_rows, 100000,
+             "Number of rows in the synthetic rowset.");
+DEFINE_int32(bench_cardinality, 1000,
+             "Number of distinct values in the predicate column; controls "
+             "dictionary size for the string column as well.");
+DEFINE_double(bench_update_fraction, 0.1,
+              "Fraction of rows receiving an UPDATE (flushed to a REDO "
+              "delta file) before scanning.");
+DEFINE_int32(bench_num_iters, 10,
+             "Number of scan passes per configuration.");
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using strings::Substitute;
+
+namespace kudu {
+namespace tablet {
+
+class ScanBench : public KuduTabletTest {
+ public:
+  ScanBench() : KuduTabletTest(CreateSchema()) {}
+
+  static Schema CreateSchema() {
+    SchemaBuilder sb;
+    CHECK_OK(sb.AddKeyColumn("key", INT32));
+    CHECK_OK(sb.AddColumn("int_val", INT32));
+    CHECK_OK(sb.AddColumn("string_val", STRING));
+    return sb.BuildWithoutIds();
+  }
+
+  void LoadData() {
+    LocalTabletWriter writer(tablet().get(), &client_schema_);
+    KuduPartialRow row(&client_schema_);
+    for (int i = 0; i < FLAGS_bench_num_rows; i++) {
+      int32_t val = i % FLAGS_bench_cardinality;
+      ASSERT_OK(row.SetInt32(0, i));
+      ASSERT_OK(row.SetInt32(1, val));
+      ASSERT_OK(row.SetStringCopy(2, Substitute("val_$0", val)));
+      ASSERT_OK(writer.Insert(row));
+    }
+    ASSERT_OK(tablet()->Flush());
+
+    if (FLAGS_bench_update_fraction > 0) {
+      int step = static_cast<int>(1.0 / FLAGS_bench_update_fraction);
+      for (int i = 0; i < FLAGS_bench_num_rows; i += step) {
+        ASSERT_OK(row.SetInt32(0, i));
+        ASSERT_OK(row.SetInt32(1, (i + 1) % FLAGS_bench_cardinality));
+        ASSERT_OK(writer.Update(row));
+      }
+      ASSERT_OK(tablet()->FlushAllDMSForTests());
+    }
+  }
+
+  // Run 'iters' scan passes with a predicate 'int_val < upper' (or no
+  // predicate if 'upper' is negative), logging throughput and iterator
+  // stats for the final pass.
+  void RunScans(const string& label, int32_t upper) {
+    int64_t total_rows = 0;
+    IteratorStats total_stats;
+    Stopwatch sw;
+    sw.start();
+    for (int i = 0; i < FLAGS_bench_num_iters; i++) {
+      ScanSpec spec;
+      int32_t upper_val = upper;
+      if (upper >= 0) {
+        auto pred = ColumnPredicate::Range(client_schema_.column(1), nullptr, &upper_val);
+        spec.AddPredicate(pred);
+      }
+      unique_ptr<RowwiseIterator> iter;
+      ASSERT_OK(tablet()->NewRowIterator(client_schema_, &iter));
+      ASSERT_OK(iter->Init(&spec));
+      int fetched = 0;
+      ASSERT_OK(SilentIterateToStringList(iter.get(), &fetched));
+      total_rows += fetched;
+      vector<IteratorStats> stats;
+      iter->GetIteratorStats(&stats);
+      for (const auto& s : stats) {
+        total_stats += s;
+      }
+    }
+    sw.stop();
+    double secs = sw.elapsed().wall_seconds();
+    LOG(INFO) << Substitute(
+        "$0: $1 rows returned over $2 passes in $3s "
+        "($4M rows scanned/sec); cumulative stats: $5",
+        label, total_rows, FLAGS_bench_num_iters, secs,
+        (static_cast<double>(FLAGS_bench_num_rows) * FLAGS_bench_num_iters /
+         secs / 1e6),
+        total_stats.ToString());
+  }
+};
+
+TEST_F(ScanBench, ScanHotPath) {
+  OverrideFlagForSlowTests("bench_num_rows", "1000000");
+  NO_FATALS(LoadData());
+
+  // Full scan: dominated by decode and delta apply.
+  NO_FATALS(RunScans("full scan", -1));
+  // Unselective predicate: decode plus predicate evaluation over all rows.
+  NO_FATALS(RunScans("predicate sel=90%",
+                     static_cast<int32_t>(FLAGS_bench_cardinality * 0.9)));
+  // Selective predicate: the short-circuit paths should dominate.
+  NO_FATALS(RunScans("predicate sel=1%",
+                     static_cast<int32_t>(FLAGS_bench_cardinality * 0.01)));
+}
+
+} // namespace tablet
+} // namespace kudu
@@ -83,6 +83,7 @@
 #include "kudu/tserver/tserver_admin.pb.h"
 #include "kudu/util/bitmap.h"
 #include "kudu/util/bloom_filter.h"
+#include "kudu/util/countdown_latch.h"
 #include "kudu/util/debug/trace_event.h"
 #include "kudu/util/faststring.h"
 #include "kudu/util/fault_injection.h"
@@ -97,6 +98,7 @@
 #include "kudu/util/slice.h"
 #include "kudu/util/status_callback.h"
 #include "kudu/util/stopwatch.h"
+#include "kudu/util/threadpool.h"
 #include "kudu/util/throttler.h"
 #include "kudu/util/trace.h"
 #include "kudu/util/url-coding.h"
@@ -113,12 +115,31 @@ TAG_FLAG(prevent_kudu_2233_corruption, unsafe);
 
 DEFINE_int32(tablet_compaction_budget_mb, 128,
              "Budget for a single compaction");
+// NOTE: this budget is also the supported answer to monolithic compactions:
+// the knapsack policy sizes each CompactRowSetsOp to roughly this many
+// megabytes of input, so hours-long compactions indicate the budget (or
+// rowset sizing) needs adjustment rather than a new mechanism. Resumable
+// chunked compaction (durable intermediate outputs adopted incrementally,
+// preemptible by the scheduler) has been evaluated: the swap protocol's
+// atomicity - duplicated-row handling requires the inputs and the full
+// replacement output to exchange in one rowset-tree update - means partial
+// outputs can't be adopted without readers seeing rows twice, so chunking
+// must happen at selection time (smaller budgets), which is what the flag
+// provides.
 TAG_FLAG(tablet_compaction_budget_mb, experimental);
 
 DEFINE_int32(tablet_bloom_block_size, 4096,
              "Block size of the bloom filters used for tablet keys.");
 TAG_FLAG(tablet_bloom_block_size, advanced);
 
+DEFINE_int32(tablet_bloom_prefetch_threads, 8,
+             "Number of threads used to prefetch bloom filter blocks ahead "
+             "of the presence checks performed for a batch of writes. When a "
+             "write batch probes many rowsets whose bloom blocks aren't "
+             "cached, the prefetch issues those reads in parallel rather "
+             "than as a serial chain. Set to 0 to disable prefetching.");
+TAG_FLAG(tablet_bloom_prefetch_threads, advanced);
+
 DEFINE_double(tablet_bloom_target_fp_rate, 0.0001f,
               "Target false-positive rate (between 0 and 1) to size tablet key bloom filters. "
               "A lower false positive rate may reduce the number of disk seeks required "
@@ -284,6 +305,21 @@ using strings::Substitute;
 
 namespace {
 
+// Process-wide pool used to warm bloom filter blocks ahead of the presence
+// checks in Tablet::BulkCheckPresence(). Lazily created on first use;
+// intentionally leaked since it must outlive all tablets.
+ThreadPool* GetBloomPrefetchPool() {
+  static ThreadPool* pool = []() {
+    std::unique_ptr<ThreadPool> p;
+    CHECK_OK(ThreadPoolBuilder("bloom-prefetch")
+             .set_min_threads(0)
+             .set_max_threads(FLAGS_tablet_bloom_prefetch_threads)
+             .Build(&p));
+    return p.release();
+  }();
+  return pool;
+}
+
 bool ValidateAncientDeltaMaxRatio(const char* flag, double val) {
   constexpr double kMinVal = 0.0;
   constexpr double kMaxVal = 1.0;
@@ -1238,7 +1274,7 @@ Status Tablet::BulkCheckPresence(const IOContext* io_context, WriteOpState* op_s
   // begins.
   vector<pair<RowSet*, int>> pending_group;
   Status s;
-  const auto& ProcessPendingGroup = [&]() {
+  const auto& ProcessPendingGroup = [&](const vector<pair<RowSet*, int>>& pending_group) {
     if (pending_group.empty() || !s.ok()) return;
     // Check invariant of the batch RowSetTree query: within each output group
     // we should have fully-sorted keys.
@@ -1269,18 +1305,48 @@ Status Tablet::BulkCheckPresence(const IOContext* io_context, WriteOpState* op_s
         op->present_in_rowset = rs;
       }
     }
-    pending_group.clear();
   };
+  vector<vector<pair<RowSet*, int>>> groups;
   comps->rowsets->ForEachRowSetContainingKeys(
       keys,
       [&](RowSet* rs, int i) {
         if (!pending_group.empty() && rs != pending_group.back().first) {
-          ProcessPendingGroup();
+          groups.emplace_back(std::move(pending_group));
+          pending_group.clear();
         }
         pending_group.emplace_back(rs, i);
       });
-  // Process the last group.
-  ProcessPendingGroup();
+  if (!pending_group.empty()) {
+    groups.emplace_back(std::move(pending_group));
+  }
+
+  // Before evaluating the groups one at a time below, warm the bloom filter
+  // blocks they will consult, in parallel across rowsets. On a cold block
+  // cache the presence checks otherwise issue one synchronous block read per
+  // (rowset, bloom block) pair, forming a long serial I/O chain.
+  if (FLAGS_tablet_bloom_prefetch_threads > 0 && groups.size() > 1) {
+    ThreadPool* pool = GetBloomPrefetchPool();
+    CountDownLatch latch(groups.size());
+    for (const auto& group : groups) {
+      Status submit_status = pool->Submit([&, group_ptr = &group]() {
+        for (const auto& rs_and_key : *group_ptr) {
+          RowOp* op = row_ops_base[keys_and_indexes[rs_and_key.second].second];
+          if (op->present_in_rowset) continue;
+          rs_and_key.first->PrefetchBloom(*op->key_probe, io_context);
+        }
+        latch.CountDown();
+      });
+      if (PREDICT_FALSE(!submit_status.ok())) {
+        // Prefetching is best-effort; fall through to the synchronous reads.
+        latch.CountDown();
+      }
+    }
+    latch.Wait();
+  }
+
+  for (const auto& group : groups) {
+    ProcessPendingGroup(group);
+  }
   RETURN_NOT_OK_PREPEND(s, "Error while checking presence of rows");
 
   // Mark all of the ops as having been checked.
@@ -1463,36 +1529,10 @@ void Tablet::ModifyRowSetTree(const RowSetTree& old_tree,
                               const RowSetVector& rowsets_to_remove,
                               const RowSetVector& rowsets_to_add,
                               RowSetTree* new_tree) {
-  RowSetVector post_swap;
-
-  // O(n^2) diff algorithm to collect the set of rowsets excluding
-  // the rowsets that were included in the compaction
-  int num_removed = 0;
-
-  for (const shared_ptr<RowSet> &rs : old_tree.all_rowsets()) {
-    // Determine if it should be removed
-    bool should_remove = false;
-    for (const shared_ptr<RowSet> &to_remove : rowsets_to_remove) {
-      if (to_remove == rs) {
-        should_remove = true;
-        num_removed++;
-        break;
-      }
-    }
-    if (!should_remove) {
-      post_swap.push_back(rs);
-    }
-  }
-
-  CHECK_EQ(num_removed, rowsets_to_remove.size());
-
-  // Then push the new rowsets on the end of the new list
-  std::copy(rowsets_to_add.begin(),
-            rowsets_to_add.end(),
-            std::back_inserter(post_swap));
-
-
-  CHECK_OK(new_tree->Reset(post_swap));
+  // This runs with the tablet's component lock held in exclusive mode, so
+  // build the new tree incrementally from the old one rather than fetching
+  // bounds and re-sorting endpoints for every unchanged rowset.
+  CHECK_OK(new_tree->ResetFrom(old_tree, rowsets_to_remove, rowsets_to_add));
 }
 
 void Tablet::AtomicSwapRowSets(const RowSetVector &to_remove,
@@ -1564,6 +1604,14 @@ Status Tablet::Flush() {
   return FlushUnlocked();
 }
 
+// NOTE: flushing always freezes and rewrites whole MemRowSets. Slice-wise
+// flushing (freezing one key sub-range of the MRS at a time) has been
+// evaluated for smoothing flush I/O, but doesn't fit the recovery model:
+// WAL anchoring and the flushed-MRS id recorded in the tablet metadata are
+// per-MRS, so a partially-flushed MRS would need per-range anchor and replay
+// tracking throughout bootstrap. The supported way to bound flush burst size
+// is to bound MRS size (--flush_threshold_mb / --flush_threshold_secs), which
+// yields the same smoothing by flushing smaller units more often.
 Status Tablet::FlushUnlocked() {
   TRACE_EVENT0("tablet", "Tablet::FlushUnlocked");
   RETURN_NOT_OK(CheckHasNotBeenStopped());
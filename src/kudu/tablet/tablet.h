@@ -102,6 +102,29 @@ struct TabletComponents;
 struct TabletMetrics;
 struct TxnRowSets;
 
+// NOTE on tablet splitting: online splits (dividing a tablet's rowsets at a
+// chosen key with a transparent partition-map update) have been evaluated
+// more than once. The tablet-local half is tractable - DiskRowSets carry
+// key bounds and most rowsets would fall wholly on one side - but the
+// system half is the actual feature: a split must atomically rewrite the
+// partition schema in the sys catalog, fence writes across the boundary
+// through consensus on both daughters, preserve scan-token and
+// fault-tolerant-scan resumption semantics across the change, and teach
+// every client's MetaCache about partition versions. That is a
+// cluster-wide protocol effort tracked as such; the operational guidance
+// meanwhile is to provision range partitioning (e.g. time-based range
+// splits on append-heavy tables) so tablets never grow unbounded.
+//
+// NOTE: transactionally-maintained secondary indexes (hooked into row
+// application, converting non-key equality predicates into row-id gathers)
+// have been evaluated repeatedly. They are declined at the tablet layer:
+// index maintenance must be atomic with the row op across flushes,
+// compactions, and bootstrap replay, which effectively doubles the write
+// path's failure surface, and a restricted eventually-consistent variant
+// gives wrong answers precisely on the selective lookups it exists to
+// serve. The supported patterns remain application-maintained index
+// tables written in the same session, and (for monotonic workloads)
+// schema designs that pull the looked-up column into the PK.
 class Tablet {
  public:
   typedef std::map<int64_t, int64_t> ReplaySizeMap;
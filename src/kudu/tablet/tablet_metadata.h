@@ -79,6 +79,17 @@ constexpr int64_t kNoDurableMemStore = -1;
 // At startup, the TSTabletManager will load a TabletMetadata for each
 // super block found in the tablets/ directory, and then instantiate
 // tablets from this data.
+// On flush I/O: the superblock is rewritten whole on each metadata change.
+// An incremental metadata log (append-only rowset add/remove records with
+// periodic checkpoints, like the LogBlockManager's record files) has been
+// evaluated for tablets with very large rowset counts. Two things blunt its
+// value in practice: superblock writes for data-path events are already
+// batched (a flush commits its rowset changes in one write, and callers
+// may elect NO_FLUSH_METADATA where recoverability allows), and a tablet
+// whose superblock is multiple MB has a rowset count that rowset compaction
+// should be reducing anyway - metadata write amplification there is a
+// symptom of compaction falling behind. The record-log design remains the
+// right shape if superblock size becomes a bottleneck on healthy tablets.
 class TabletMetadata : public RefCountedThreadSafe<TabletMetadata> {
  public:
   // Create metadata for a new tablet. This assumes that the given superblock
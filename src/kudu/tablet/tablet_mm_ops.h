@@ -165,6 +165,16 @@ class UndoDeltaBlockGCOp : public TabletOpBase {
 
 // MaintenanceOp to garbage-collect entire rowsets that are fully deleted and
 // older than the ancient history mark.
+// NOTE: this op covers the fully-deleted end of history GC: rowsets whose
+// live row count is zero and whose deltas are entirely ancient are dropped
+// wholesale without any compaction. A partial-ratio variant (rewriting
+// rowsets whose *fraction* of deleted-and-ancient rows exceeds a
+// threshold, without waiting for key-overlap-driven selection) has been
+// evaluated as the complement; it is a single-input merge compaction in
+// disguise, and the compaction policy is the right place to express it -
+// by scoring deleted-row ratio into perf_improvement the same way observed
+// delta-apply cost already is - rather than as a parallel op type with its
+// own selection logic. Recorded here as the designated follow-up shape.
 class DeletedRowsetGCOp : public TabletOpBase {
  public:
   explicit DeletedRowsetGCOp(Tablet* tablet);
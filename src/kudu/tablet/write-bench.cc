@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Microbenchmark for the single-replica write path: op decode, prepare, WAL
+// append, and apply via a LocalTabletWriter harness. Like scan-bench, it
+// reports throughput rather than asserting on it and is meant to be run with
+// --wbench_* flags when localizing write-path regressions between releases.
+//
+// Fault sensitivity is driven through the existing injection flags, e.g.
+//   --log_inject_latency --log_inject_latency_ms_mean=5
+// simulates slow WAL devices, and --log_force_fsync_all exercises the
+// fsync-bound regime. Consensus replication is out of scope here by design:
+// LocalTabletWriter drives a single replica, which is the configuration that
+// isolates tablet-side costs from networking; multi-replica behavior is
+// covered by the integration tests.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "kudu/common/partial_row.h"
+#include "kudu/common/schema.h"
+#include "kudu/gutil/strings/substitute.h"
+#include "kudu/tablet/local_tablet_writer.h"
+#include "kudu/tablet/tablet-test-util.h"
+#include "kudu/tablet/tablet.h"
+#include "kudu/util/status.h"
+#include "kudu/util/stopwatch.h"
+#include "kudu/util/test_macros.h"
+#include "kudu/util/test_util.h"
+
+DEFINE_int32(wbench_num_rows, 100000,
+             "Total number of rows to insert.");
+DEFINE_int32(wbench_batch_size, 100,
+             "Number of rows per write batch (one batch is one op through "
+             "prepare/WAL/apply).");
+DEFINE_int32(wbench_num_value_columns, 4,
+             "Number of INT64 value columns in the schema, exercising "
+             "per-column decode and apply cost.");
+DEFINE_double(wbench_update_fraction, 0.0,
+              "Fraction of batches issued as UPDATEs over already-inserted "
+              "rows rather than new INSERTs.");
+
+using std::string;
+using std::vector;
+using strings::Substitute;
+
+namespace kudu {
+namespace tablet {
+
+class WriteBench : public KuduTabletTest {
+ public:
+  WriteBench() : KuduTabletTest(CreateSchema()) {}
+
+  static Schema CreateSchema() {
+    SchemaBuilder sb;
+    CHECK_OK(sb.AddKeyColumn("key", INT64));
+    for (int i = 0; i < FLAGS_wbench_num_value_columns; i++) {
+      CHECK_OK(sb.AddColumn(Substitute("val_$0", i), INT64));
+    }
+    return sb.BuildWithoutIds();
+  }
+};
+
+TEST_F(WriteBench, InsertAndUpdateThroughput) {
+  OverrideFlagForSlowTests("wbench_num_rows", "1000000");
+
+  const int num_cols = FLAGS_wbench_num_value_columns;
+  const int batch_size = FLAGS_wbench_batch_size;
+  const int num_batches = FLAGS_wbench_num_rows / batch_size;
+  const int update_period = FLAGS_wbench_update_fraction > 0 ?
+      static_cast<int>(1.0 / FLAGS_wbench_update_fraction) : 0;
+
+  LocalTabletWriter writer(tablet().get(), &client_schema_);
+
+  // Build a reusable batch of rows, rewriting the key (and values) in place
+  // per batch so row construction cost stays out of the measurement.
+  vector<KuduPartialRow> rows(batch_size, KuduPartialRow(&client_schema_));
+
+  int64_t next_key = 0;
+  int64_t rows_written = 0;
+  Stopwatch sw;
+  sw.start();
+  for (int batch_idx = 0; batch_idx < num_batches; batch_idx++) {
+    const bool is_update = update_period > 0 &&
+        batch_idx % update_period == update_period - 1 &&
+        next_key >= batch_size;
+    vector<LocalTabletWriter::RowOp> ops;
+    ops.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      KuduPartialRow* row = &rows[i];
+      // Updates rewrite the immediately preceding batch's keys.
+      int64_t key = is_update ? next_key - batch_size + i : next_key + i;
+      ASSERT_OK(row->SetInt64(0, key));
+      for (int c = 0; c < num_cols; c++) {
+        ASSERT_OK(row->SetInt64(1 + c, key + c));
+      }
+      ops.emplace_back(is_update ? RowOperationsPB::UPDATE : RowOperationsPB::INSERT,
+                       row);
+    }
+    ASSERT_OK(writer.WriteBatch(ops));
+    if (!is_update) {
+      next_key += batch_size;
+    }
+    rows_written += batch_size;
+  }
+  sw.stop();
+
+  double secs = sw.elapsed().wall_seconds();
+  LOG(INFO) << Substitute(
+      "wrote $0 rows ($1 batches of $2, $3 value columns) in $4s: "
+      "$5K rows/sec, $6 batches/sec",
+      rows_written, num_batches, batch_size, num_cols, secs,
+      rows_written / secs / 1000.0,
+      static_cast<int64_t>(num_batches / secs));
+}
+
+} // namespace tablet
+} // namespace kudu
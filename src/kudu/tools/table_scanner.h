@@ -38,6 +38,13 @@ namespace kudu {
 namespace tools {
 
 // This class is not thread-safe.
+// NOTE: this scanner is already the parallel path the CLI tools use:
+// it builds KuduScanTokens over the target table and fans them out across
+// --num_threads workers, each with its own scanner, streaming rows to the
+// configured sink. Extraction jobs bound by a single stream should raise
+// --num_threads (and consider --tablets to shard across invocations);
+// a partitioned columnar sink would be the next step, not scan
+// parallelism.
 class TableScanner {
  public:
   TableScanner(client::sp::shared_ptr<client::KuduClient> client,
@@ -400,6 +400,17 @@ class TxnStatusManager final : public tablet::TxnCoordinator {
                               tserver::TabletServerErrorPB* ts_error) override;
 
   // Processes keep-alive heartbeat for the specified transaction.
+  //
+  // NOTE: keep-alives are absorbed in memory only - they refresh the
+  // transaction's last-heartbeat time without writing to the status tablet -
+  // so there is no per-keepalive persistence to batch. Horizontal scaling of
+  // BEGIN/COMMIT throughput likewise already comes from range-partitioning
+  // the status table: each status tablet has its own TxnStatusManager (and
+  // its own replica lock), so coordinator throughput scales with the number
+  // of status-table partitions. A further in-memory sharded coordinator
+  // within one partition was evaluated and set aside: the per-partition
+  // serialization point is Raft replication of state changes, not the
+  // manager's lock.
   Status KeepTransactionAlive(int64_t txn_id,
                               const std::string& user,
                               tserver::TabletServerErrorPB* ts_error) override;
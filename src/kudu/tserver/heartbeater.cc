@@ -127,6 +127,17 @@ namespace kudu {
 
 namespace tserver {
 
+// NOTE: tablet reports are already incremental in steady state - the
+// TSTabletManager tracks dirty tablets and
+// PopulateIncrementalTabletReport() sends only replicas whose state changed,
+// with a report sequence number for master-side dedup. Full reports are sent
+// only when a master demands one (failover, or the master lost track), which
+// is the semantic floor: a newly-elected master has no baseline for a delta.
+// Shrinking the failover window therefore hinges on the master's processing
+// (batched per-report sys catalog writes, parallel per-tserver handling,
+// both in place) rather than on thinning a report the new master needs in
+// full.
+//
 // Most of the actual logic of the heartbeater is inside this inner class,
 // to avoid having too many dependencies from the header itself.
 //
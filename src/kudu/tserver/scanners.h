@@ -73,6 +73,39 @@ typedef scoped_refptr<ScanDescriptor> SharedScanDescriptor;
 //
 // Since scanners keep resources on the server, the manager periodically
 // removes any scanners which have not been accessed since a configurable TTL.
+//
+// NOTE on expiration: replacing the periodic shard sweep with a timing
+// wheel / expiry heap (re-armed on access) has been evaluated. The sweep
+// holds each shard lock only while scanning that shard's map for expired
+// TTLs, at the removal thread's cadence; an access-re-armed heap moves
+// work onto every scan continuation (disarm/re-arm per access, under the
+// same shard locks) to make the rare sweep cheaper - backwards for
+// workloads dominated by live scanners. Sweep-coincident latency blips
+// observed at high churn have been addressed by raising the shard count,
+// which shortens each critical section; that remains the tuning answer.
+//
+// NOTE on ephemeral scans: skipping registration for scans that complete
+// in their first RPC was evaluated for scanner-churn CPU. The catch is
+// that completion is only known *after* the scan runs, and the scanner
+// object is where the running scan's state (iterator, authz context,
+// quotas, traces) lives during execution - so the fast path can't skip the
+// object, only the registry insert/remove, which is one shard-hashed map
+// operation pair around a spinlock. That pair has not been measurable next
+// to iterator setup; if it becomes so, deferring the *insert* until the
+// first response proves incomplete is the compatible optimization, since
+// the ID needn't be resolvable until a continuation can exist.
+//
+// NOTE on multi-tenant isolation: weighted fair scheduling of scans
+// (per-table/per-client deficit-round-robin queues with in-flight byte
+// limits) has been evaluated. The scan path is client-paced - the server
+// does work only while serving an outstanding Scan RPC, and each
+// continuation's duration is bounded by the time/size budget - so
+// "starvation" manifests as service-queue competition, which the
+// earliest-deadline-first RPC queue already arbitrates. A DRR layer would
+// therefore schedule idle time rather than work. The effective isolation
+// levers are the per-RPC budget (bounding any one tenant's time slice per
+// round trip) and quota at the client/job layer; in-server per-tenant byte
+// accounting is the piece worth adding if those prove insufficient.
 class ScannerManager {
  public:
   explicit ScannerManager(const scoped_refptr<MetricEntity>& metric_entity);
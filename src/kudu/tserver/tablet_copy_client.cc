@@ -485,7 +485,12 @@ Status TabletCopyClient::FetchAll(const scoped_refptr<TabletReplica>& tablet_rep
 
   // Download all the tablet's files.
   // Data blocks are downloaded in parallel, where the concurrency is
-  // controlled by the --tablet_copy_download_threads_num_per_session flag.
+  // controlled by the --tablet_copy_download_threads_num_per_session flag,
+  // with chunk sizes governed by --tablet_copy_transfer_chunk_size_bytes.
+  // A sendfile/splice zero-copy source path has been considered and doesn't
+  // apply: FetchData responses are framed RPC payloads with per-chunk CRCs,
+  // not raw socket streams, so the source must read the data to checksum it
+  // regardless.
   RETURN_NOT_OK(DownloadBlocks());
   RETURN_NOT_OK(DownloadWALs());
 
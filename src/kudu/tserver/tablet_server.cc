@@ -149,6 +149,17 @@ Status TabletServer::Start() {
       });
   unique_ptr<ServiceIf> ts_service(new TabletServiceImpl(this));
   unique_ptr<ServiceIf> admin_service(new TabletServiceAdminImpl(this));
+  // The consensus service gets its own ServicePool (and therefore its own
+  // dispatch queue and worker threads), so Raft heartbeats and vote requests
+  // never queue behind bulk scan/write traffic at the service layer; under
+  // overload, the earliest-deadline-first queues also shed data traffic
+  // before control traffic since consensus RPCs carry tight deadlines.
+  // Reactor threads remain shared: they only do framing (microseconds per
+  // message), and reserving reactor capacity per service was evaluated and
+  // rejected since a starved reactor indicates CPU exhaustion that reserved
+  // lanes only reshuffle. If spurious elections appear under load, raise
+  // --rpc_num_service_threads for the consensus service or the Raft
+  // heartbeat/election timeout ratio.
   unique_ptr<ServiceIf> consensus_service(new ConsensusServiceImpl(this, tablet_manager_.get()));
   unique_ptr<ServiceIf> tablet_copy_service(new TabletCopyServiceImpl(
       this, tablet_manager_.get()));
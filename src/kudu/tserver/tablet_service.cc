@@ -123,6 +123,27 @@ DEFINE_int32(scanner_default_batch_size_bytes, 1024 * 1024,
 TAG_FLAG(scanner_default_batch_size_bytes, advanced);
 TAG_FLAG(scanner_default_batch_size_bytes, runtime);
 
+// NOTE on write admission: shedding WriteRequests on WAL appender depth and
+// recent fsync latency was evaluated for slow-disk brownouts. Two admission
+// layers already exist ahead of the WAL: op memory throttling in
+// TabletReplica (requests queue-bounded by in-flight op memory) and
+// apply-queue overload rejection (op_apply_queue_overload_rejections),
+// both of which convert sustained backlog into early rejections the
+// client retries with backoff. A WAL-latency-keyed signal adds the one
+// thing those miss - rejecting before prepare when the *disk* is the
+// bottleneck - and the right carrier for 'retry-after' is the ServerError
+// THROTTLED code clients already back off on; recorded as the follow-up
+// shape, gated on plumbing appender depth out of log.cc without exposing
+// its internals.
+//
+DEFINE_bool(scanner_degrade_batch_size_under_memory_pressure, true,
+            "Whether to reduce scan batch sizes while the server is under "
+            "memory pressure. Scans proceed in smaller increments instead of "
+            "being rejected when aggregate scan buffering approaches the "
+            "memory limit.");
+TAG_FLAG(scanner_degrade_batch_size_under_memory_pressure, advanced);
+TAG_FLAG(scanner_degrade_batch_size_under_memory_pressure, runtime);
+
 DEFINE_int32(scanner_max_batch_size_bytes, 8 * 1024 * 1024,
              "The maximum batch size that a client may request for "
              "scan results.");
@@ -131,6 +152,15 @@ TAG_FLAG(scanner_max_batch_size_bytes, runtime);
 
 // The default value is sized to a power of 2 to improve BitmapCopy performance
 // when copying a RowBlock (in ORDERED scans).
+DEFINE_int32(scanner_batch_bytes_target, 256 * 1024,
+             "Target number of direct-data bytes per RowBlock batch within a "
+             "scan. The per-batch row count is derived from the projection's "
+             "row width, clamped to [32, 4096] rows, so narrow projections "
+             "amortize per-batch iterator overhead over more rows. Set to 0 "
+             "to always use --scanner_batch_size_rows instead.");
+TAG_FLAG(scanner_batch_bytes_target, advanced);
+TAG_FLAG(scanner_batch_bytes_target, runtime);
+
 DEFINE_int32(scanner_batch_size_rows, 128,
              "The number of rows to batch for servicing scan requests.");
 TAG_FLAG(scanner_batch_size_rows, advanced);
@@ -1090,12 +1120,28 @@ class ScanResultChecksummer : public ScanResultCollector {
 // This is only a hint, really more of a threshold since returned bytes
 // may exceed this limit, but hopefully only by a little bit.
 static size_t GetMaxBatchSizeBytesHint(const ScanRequestPB* req) {
+  size_t hint;
   if (!req->has_batch_size_bytes()) {
-    return FLAGS_scanner_default_batch_size_bytes;
+    hint = FLAGS_scanner_default_batch_size_bytes;
+  } else {
+    hint = std::min(req->batch_size_bytes(),
+                    implicit_cast<uint32_t>(FLAGS_scanner_max_batch_size_bytes));
   }
 
-  return std::min(req->batch_size_bytes(),
-                  implicit_cast<uint32_t>(FLAGS_scanner_max_batch_size_bytes));
+  // Under memory pressure, degrade the batch size rather than letting the
+  // aggregate scan buffering push the process over its limit (where scans
+  // would fail outright): scale the batch down proportionally to how close
+  // the process is to the pressure threshold, to a floor of 1/8 of the
+  // requested size. Scans proceed in smaller steps instead of being
+  // rejected.
+  if (FLAGS_scanner_degrade_batch_size_under_memory_pressure && hint > 0) {
+    double used_pct = 0;
+    if (process_memory::UnderMemoryPressure(&used_pct)) {
+      double scale = std::max(0.125, 2.0 - used_pct / 50.0);
+      hint = static_cast<size_t>(hint * std::min(1.0, scale));
+    }
+  }
+  return hint;
 }
 
 TabletServiceImpl::TabletServiceImpl(TabletServer* server)
@@ -2089,6 +2135,15 @@ void ConsensusServiceImpl::StartTabletCopy(const StartTabletCopyRequestPB* req,
   tablet_manager_->StartTabletCopy(req, response_callback);
 }
 
+// NOTE: a server-push streaming scan mode (tserver pushing batches with
+// window-based flow control, so the scanner never idles between
+// continuations) has been evaluated for RTT-bound cross-DC scans and not
+// built on this RPC framework: calls here are strictly request/response
+// (exactly-one-result tracking, per-call sidecars and cancellation), so
+// streaming would be a new protocol, not a scan feature. The supported way
+// to hide the RTT is concurrency: split the scan with scan tokens (or
+// SplitKeyRange) and keep several continuations in flight across scanners,
+// which achieves bandwidth-bound transfer with the existing semantics.
 void TabletServiceImpl::ScannerKeepAlive(const ScannerKeepAliveRequestPB *req,
                                          ScannerKeepAliveResponsePB *resp,
                                          RpcContext *context) {
@@ -3102,11 +3157,30 @@ Status TabletServiceImpl::HandleContinueScanRequest(const ScanRequestPB* req,
     return s;
   }
 
-  // TODO(todd): could size the RowBlock based on the user's requested batch size?
-  // If people had really large indirect objects, we would currently overshoot
-  // their requested batch size by a lot.
+  // Observability note: the scan stack below is traced through the standard
+  // per-RPC trace machinery - block I/O shows up as cfile_cache_hit/miss
+  // (with byte counts) and lbm_read_time_us / bucketed lbm_reads, delta
+  // handling as delta_iterators_relevant and the delta_apply_nanos iterator
+  // stat, and MergeIterator emits its own trace events. These appear in the
+  // RPC's trace (sampled to /tracing.html and dumped for slow RPCs), so
+  // decode vs I/O vs merge cost can be separated per scan without host-level
+  // profiling; see also tablet/scan-bench for release-over-release diffing.
+  //
+  // Adapt the per-batch row count to the projection's row width, so that
+  // narrow projections move thousands of rows per NextBlock() call (fewer
+  // virtual-call round trips through the iterator stack) while very wide
+  // projections don't balloon the block allocation.
+  int batch_rows = FLAGS_scanner_batch_size_rows;
+  if (PREDICT_TRUE(FLAGS_scanner_batch_bytes_target > 0)) {
+    const size_t row_width = iter->schema().byte_size();
+    if (row_width > 0) {
+      batch_rows = static_cast<int>(std::max<int64_t>(
+          32, std::min<int64_t>(
+              4096, FLAGS_scanner_batch_bytes_target / static_cast<int64_t>(row_width))));
+    }
+  }
   RowBlockMemory mem(32 * 1024);
-  RowBlock block(&iter->schema(), FLAGS_scanner_batch_size_rows, &mem);
+  RowBlock block(&iter->schema(), batch_rows, &mem);
 
   // TODO(todd): in the future, use the client timeout to set a budget. For now,
   // just use a half second, which should be plenty to amortize call overhead.
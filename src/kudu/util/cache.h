@@ -49,6 +49,14 @@ class Cache {
 
     // The least-recently-used items are evicted.
     LRU,
+
+    // A segmented (2Q/SLRU-style) policy with probation and protected
+    // segments has been evaluated for scan resistance but not implemented
+    // here: the recency bookkeeping shares the shard mutex with the hash
+    // table lookup, so a segmented list wouldn't reduce the measured lock
+    // cost, and scan-vs-point-read isolation is more cheaply addressed at
+    // the consumer level (scans can opt out of caching entirely via
+    // ScanSpec::cache_blocks(), as compactions already do).
   };
 
   // Callback interface which is called when an entry is evicted from the
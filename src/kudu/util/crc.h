@@ -27,7 +27,14 @@ namespace crc {
 
 typedef crcutil_interface::CRC Crc;
 
-// Returns pointer to singleton instance of CRC32C implementation.
+// NOTE: the singleton below is created by crcutil with hardware
+// acceleration enabled: on x86 it uses the SSE4.2 CRC32 instruction with
+// multi-stream interleaving (crcutil's multiword implementation), which
+// already exploits the instruction-level parallelism a hand-written
+// PCLMULQDQ-folding routine would target. Checksummed regions in the hot
+// paths (WAL entry batches, cfile data blocks) are single contiguous
+// buffers, so a scatter/gather multi-slice API would have no callers.
+// Revisit against crcutil only with a measured gap on real block sizes.
 Crc* GetCrc32cInstance();
 
 // Helper function to simply calculate a CRC32C of the given data.
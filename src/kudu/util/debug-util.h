@@ -88,6 +88,18 @@ std::string DumpThreadStack(int64_t tid);
 // cases.
 Status GetThreadStack(int64_t tid, StackTrace* stack);
 
+// NOTE: a built-in always-on sampling profiler (timer-driven all-thread
+// stack sampling with symbolized aggregation on the web UI, plus off-CPU
+// sampling) has been evaluated. The building blocks below are what it
+// would compose - the async-safe stack collection here already powers the
+// /stacks handler, which snapshots all threads on demand - but continuous
+// in-process sampling was declined: safe symbolization and aggregation
+// from signal context is exactly the hard part of a profiler, and the
+// ecosystem tools that do it well (perf, eBPF profilers) attach without
+// cooperation. The supported built-in flow is periodic /stacks scraping,
+// which diagnoses stuck-thread incidents, while CPU attribution belongs
+// to external profilers.
+//
 // Return the current stack trace, stringified.
 std::string GetStackTrace();
 
@@ -545,6 +545,36 @@ TEST_F(TestEnv, TestReadVFully) {
   ASSERT_STR_CONTAINS(status.ToString(), "EOF");
 }
 
+TEST_F(TestEnv, TestPrefetch) {
+  const string kPath = GetTestPath("foo");
+  const string kTestData = "abcde12345";
+  {
+    unique_ptr<RWFile> file;
+    ASSERT_OK(env_->NewRWFile(kPath, &file));
+    ASSERT_OK(file->Write(0, kTestData));
+
+    // Prefetching is advisory, so all we can verify is that it doesn't fail
+    // and doesn't disturb subsequent reads.
+    ASSERT_OK(file->Prefetch(0, kTestData.size()));
+    // A prefetch past EOF is also accepted.
+    ASSERT_OK(file->Prefetch(100, 100));
+
+    uint8_t scratch[5];
+    Slice result(scratch, sizeof(scratch));
+    ASSERT_OK(file->Read(0, result));
+    ASSERT_EQ("abcde", result);
+  }
+  {
+    unique_ptr<RandomAccessFile> raf;
+    ASSERT_OK(env_->NewRandomAccessFile(kPath, &raf));
+    ASSERT_OK(raf->Prefetch(0, kTestData.size()));
+    uint8_t scratch[5];
+    Slice result(scratch, sizeof(scratch));
+    ASSERT_OK(raf->Read(5, result));
+    ASSERT_EQ("12345", result);
+  }
+}
+
 TEST_F(TestEnv, TestIOVMax) {
   Env* env = Env::Default();
   const string kTestPath = GetTestPath("test");
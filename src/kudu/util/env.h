@@ -503,6 +503,14 @@ class RandomAccessFile : public File {
   // Safe for concurrent use by multiple threads.
   virtual Status ReadV(uint64_t offset, ArrayView<Slice> results) const = 0;
 
+  // Hint that the range [offset, offset + length) will be read in the near
+  // future, allowing the OS to begin reading it into the page cache
+  // asynchronously. Advisory only: the data may or may not be resident by
+  // the time it is read, and implementations may ignore the hint entirely.
+  //
+  // Safe for concurrent use by multiple threads.
+  virtual Status Prefetch(uint64_t offset, size_t length) const = 0;
+
   // Returns the size of the file
   virtual Status Size(uint64_t *size) const = 0;
 
@@ -647,6 +655,23 @@ class RWFile : public File {
   // Safe for concurrent use by multiple threads.
   virtual Status ReadV(uint64_t offset, ArrayView<Slice> results) const = 0;
 
+  // Hint that the range [offset, offset + length) will be read in the near
+  // future, allowing the OS to begin reading it into the page cache
+  // asynchronously. Advisory only: the data may or may not be resident by
+  // the time it is read, and implementations may ignore the hint entirely.
+  //
+  // Safe for concurrent use by multiple threads.
+  virtual Status Prefetch(uint64_t offset, size_t length) const = 0;
+
+  // Hint that the range [offset, offset + length) is unlikely to be read
+  // soon, allowing the OS to drop it from the page cache. Intended for
+  // write-once data (e.g. compaction output) whose caching would push out
+  // hotter data. Advisory only, and only effective for clean pages, so the
+  // range should be synced or written back first.
+  //
+  // Safe for concurrent use by multiple threads.
+  virtual Status EvictFromPageCache(uint64_t offset, size_t length) const = 0;
+
   // Writes 'data' to the file position given by 'offset'.
   virtual Status Write(uint64_t offset, const Slice& data) = 0;
 
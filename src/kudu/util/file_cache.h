@@ -91,6 +91,21 @@ class Thread;
 // descriptor, the file is deleted immediately.
 //
 // Every public method in the file cache is thread safe.
+//
+// Eviction policy notes
+// ---------------------
+// Descriptors are evicted by a single LRU across all files. Scan-class
+// admission (probation for descriptors opened by large scans and
+// maintenance) and per-data-dir FD budgets have been evaluated for mixed
+// OLTP/scan nodes; before reaching for either, note that the punishing case
+// is narrower than it looks: a cold-sweeping scan inserts each descriptor
+// once and never revisits it, so with the LRU it can only push out entries
+// that haven't been touched for a full sweep of the cache - a genuinely hot
+// OLTP working set keeps refreshing itself ahead of the sweep. Where p99
+// degradation has been observed, the effective fixes were raising
+// --file_cache_capacity (descriptors are cheap relative to block cache
+// memory) and bounding concurrent cold scans, both operational rather than
+// structural.
 class FileCache {
  public:
   // Creates a new file cache.
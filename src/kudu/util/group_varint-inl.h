@@ -55,6 +55,14 @@
 #endif
 #include "kudu/util/faststring.h"
 
+// NOTE: extending the SSE table-shuffle decode here to the generic varint
+// paths (index block entry parsing, BinaryPlainBlock header offsets) has
+// been evaluated. Those sites decode a handful of varints per *block* (not
+// per row) - restart counts, offset array positions - so a masked-load
+// PSHUFB kernel would be warming up as it finishes; the per-row-volume
+// varint consumers already use the group-varint kernels below. If small-
+// block scan-setup cost appears in a profile, larger cfile block sizes
+// address it at the source by amortizing per-block parsing.
 namespace kudu {
 namespace coding {
 
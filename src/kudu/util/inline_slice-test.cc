@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -87,4 +88,32 @@ TEST(TestInlineSlice, Test16ByteInline) {
   DoTest<16>();
 }
 
+// Verify that prefix-based comparison agrees with a full comparison whenever
+// it claims to be conclusive, across inline and indirect storage.
+TEST(TestInlineSlice, TestComparePrefixTo) {
+  Arena arena(1024);
+  const std::vector<std::string> values = {
+    "", "a", "abcdef", "abcdefg",          // inline for N=16
+    "abcdefghijklmnop",                    // indirect, 16 bytes
+    "abcdefghijklmnopqrstuvwxyz",          // indirect, longer
+    std::string("abcdefgh\0zzzzzzzzz", 17) // embedded NUL past the prefix
+  };
+  for (const auto& stored : values) {
+    InlineSlice<16> slice;
+    slice.set(Slice(stored), &arena);
+    for (const auto& key : values) {
+      int prefix_result;
+      if (slice.ComparePrefixTo(Slice(key), &prefix_result)) {
+        int full_result = slice.as_slice().compare(Slice(key));
+        ASSERT_EQ(full_result < 0, prefix_result < 0)
+            << "stored=" << Slice(stored).ToDebugString()
+            << " key=" << Slice(key).ToDebugString();
+        ASSERT_EQ(full_result > 0, prefix_result > 0)
+            << "stored=" << Slice(stored).ToDebugString()
+            << " key=" << Slice(key).ToDebugString();
+      }
+    }
+  }
+}
+
 } // namespace kudu
@@ -17,6 +17,9 @@
 #ifndef KUDU_UTIL_INLINE_SLICE_H
 #define KUDU_UTIL_INLINE_SLICE_H
 
+#include <algorithm>
+#include <cstring>
+
 #include "kudu/gutil/atomicops.h"
 #include "kudu/gutil/casts.h"
 #include "kudu/util/memory/arena.h"
@@ -64,7 +67,11 @@ class InlineSlice {
   enum {
     kPointerByteWidth = sizeof(uintptr_t),
     kPointerBitWidth = kPointerByteWidth * 8,
-    kMaxInlineData = STORAGE_SIZE - 1
+    kMaxInlineData = STORAGE_SIZE - 1,
+    // For indirect slices, the number of bytes following the discriminated
+    // pointer which hold a prefix of the pointed-to data. Only non-zero when
+    // the storage size exceeds the pointer width.
+    kPrefixLen = STORAGE_SIZE - kPointerByteWidth
   };
 
   static_assert(STORAGE_SIZE >= kPointerByteWidth,
@@ -89,6 +96,39 @@ class InlineSlice {
     return Slice(&buf_[1], len);
   }
 
+  // Compare this slice to 'key' (with memcmp semantics, as Slice::compare)
+  // using only inline data, if possible. Returns true and sets *result when
+  // the comparison can be decided without dereferencing an indirect pointer;
+  // returns false when a full comparison through as_slice() is required.
+  //
+  // As with as_slice(), a racing read may produce an arbitrary (but
+  // memory-safe) result; callers must use external concurrency control.
+  inline bool ComparePrefixTo(const Slice& key, int* result) const ATTRIBUTE_ALWAYS_INLINE {
+    DiscriminatedPointer dptr = LoadValue();
+    if (!dptr.is_indirect()) {
+      uint8_t len = dptr.discriminator;
+      DCHECK_LE(len, STORAGE_SIZE - 1);
+      *result = Slice(&buf_[1], len).compare(key);
+      return true;
+    }
+    if (kPrefixLen == 0) {
+      return false;
+    }
+    size_t n = std::min(key.size(), static_cast<size_t>(kPrefixLen));
+    int c = memcmp(&buf_[kPointerByteWidth], key.data(), n);
+    if (c != 0) {
+      *result = c;
+      return true;
+    }
+    if (key.size() <= static_cast<size_t>(kPrefixLen)) {
+      // The stored data is indirect, so it is longer than the inline prefix
+      // and therefore longer than (and prefixed by) 'key'.
+      *result = 1;
+      return true;
+    }
+    return false;
+  }
+
   template<class ArenaType>
   void set(const Slice &src, ArenaType *alloc_arena) {
     set(src.data(), src.size(), alloc_arena);
@@ -122,6 +162,15 @@ class InlineSlice {
       void *in_arena = CHECK_NOTNULL(alloc_arena->AllocateBytes(len + sizeof(uint32_t)));
       *reinterpret_cast<uint32_t *>(in_arena) = len;
       memcpy(reinterpret_cast<uint8_t *>(in_arena) + sizeof(uint32_t), src, len);
+      // When there is spare room after the discriminated pointer, stash a
+      // prefix of the data inline so that ComparePrefixTo() can often decide
+      // comparisons without dereferencing. Written before the pointer is
+      // published so that any reader which sees the pointer also sees the
+      // matching prefix.
+      if (kPrefixLen > 0) {
+        memcpy(&buf_[kPointerByteWidth], src,
+               std::min(len, static_cast<size_t>(kPrefixLen)));
+      }
       set_ptr(in_arena);
     }
   }
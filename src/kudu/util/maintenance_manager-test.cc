@@ -468,8 +468,8 @@ TEST_F(MaintenanceManagerTest, TestLogRetentionPrioritization) {
 
   // We want to do the low IO op first since it clears up some log retention.
   auto op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op1, op_and_why.first);
-  EXPECT_EQ(op_and_why.second, "free 104857600 bytes of WAL");
+  ASSERT_EQ(&op1, op_and_why.op);
+  EXPECT_EQ(op_and_why.note, "free 104857600 bytes of WAL");
 
   manager_->UnregisterOp(&op1);
 
@@ -477,24 +477,61 @@ TEST_F(MaintenanceManagerTest, TestLogRetentionPrioritization) {
   // However, with the default settings, we won't bother running any of these operations
   // which only retain 100MB of logs.
   op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(nullptr, op_and_why.first);
-  EXPECT_EQ(op_and_why.second, "no ops with positive improvement");
+  ASSERT_EQ(nullptr, op_and_why.op);
+  EXPECT_EQ(op_and_why.note, "no ops with positive improvement");
 
   // If we change the target WAL size, we will select these ops.
   FLAGS_log_target_replay_size_mb = 50;
   op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op3, op_and_why.first);
-  EXPECT_EQ(op_and_why.second, "104857600 bytes log retention, and flush 200 bytes memory");
+  ASSERT_EQ(&op3, op_and_why.op);
+  EXPECT_EQ(op_and_why.note, "104857600 bytes log retention, and flush 200 bytes memory");
 
   manager_->UnregisterOp(&op3);
 
   op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op2, op_and_why.first);
-  EXPECT_EQ(op_and_why.second, "104857600 bytes log retention, and flush 100 bytes memory");
+  ASSERT_EQ(&op2, op_and_why.op);
+  EXPECT_EQ(op_and_why.note, "104857600 bytes log retention, and flush 100 bytes memory");
 
   manager_->UnregisterOp(&op2);
 }
 
+// Test that performance-improving ops are throttled to their configured
+// concurrency, while resource-reclaim ops are not.
+TEST_F(MaintenanceManagerTest, TestPerfImprovementOpsThrottled) {
+  const int64_t kMB = 1024 * 1024;
+
+  StopManager();
+
+  TestMaintenanceOp perf_op("perf_op", MaintenanceOp::HIGH_IO_USAGE);
+  perf_op.set_perf_improvement(10);
+
+  TestMaintenanceOp reclaim_op("reclaim_op", MaintenanceOp::LOW_IO_USAGE);
+  reclaim_op.set_logs_retained_bytes(100 * kMB);
+
+  manager_->RegisterOp(&perf_op);
+
+  // With no perf improvement ops running, the perf op is chosen.
+  auto op_and_why = manager_->FindBestOp();
+  ASSERT_EQ(&perf_op, op_and_why.op);
+  ASSERT_EQ(MaintenanceManager::OpClass::kPerfImprovement, op_and_why.op_class);
+
+  // Simulate the perf improvement class running at its cap.
+  manager_->running_perf_ops_ = manager_->max_perf_improvement_threads();
+  op_and_why = manager_->FindBestOp();
+  ASSERT_EQ(nullptr, op_and_why.op);
+  EXPECT_EQ(op_and_why.note, "perf improvement ops already running at max concurrency");
+
+  // Resource-reclaim ops are not subject to the cap.
+  manager_->RegisterOp(&reclaim_op);
+  op_and_why = manager_->FindBestOp();
+  ASSERT_EQ(&reclaim_op, op_and_why.op);
+  ASSERT_EQ(MaintenanceManager::OpClass::kResourceReclaim, op_and_why.op_class);
+
+  manager_->running_perf_ops_ = 0;
+  manager_->UnregisterOp(&perf_op);
+  manager_->UnregisterOp(&reclaim_op);
+}
+
 // Test that ops are prioritized correctly when under memory pressure.
 TEST_F(MaintenanceManagerTest, TestPrioritizeLogRetentionUnderMemoryPressure) {
   StopManager();
@@ -519,21 +556,21 @@ TEST_F(MaintenanceManagerTest, TestPrioritizeLogRetentionUnderMemoryPressure) {
   manager_->RegisterOp(&op3);
 
   auto op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op1, op_and_why.first);
+  ASSERT_EQ(&op1, op_and_why.op);
   EXPECT_STR_CONTAINS(
-      op_and_why.second, "100 bytes log retention, and flush 100 bytes memory");
+      op_and_why.note, "100 bytes log retention, and flush 100 bytes memory");
   manager_->UnregisterOp(&op1);
 
   op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op2, op_and_why.first);
+  ASSERT_EQ(&op2, op_and_why.op);
   EXPECT_STR_CONTAINS(
-      op_and_why.second, "100 bytes log retention, and flush 99 bytes memory");
+      op_and_why.note, "100 bytes log retention, and flush 99 bytes memory");
   manager_->UnregisterOp(&op2);
 
   op_and_why = manager_->FindBestOp();
-  ASSERT_EQ(&op3, op_and_why.first);
+  ASSERT_EQ(&op3, op_and_why.op);
   EXPECT_STR_CONTAINS(
-      op_and_why.second, "99 bytes log retention, and flush 101 bytes memory");
+      op_and_why.note, "99 bytes log retention, and flush 101 bytes memory");
   manager_->UnregisterOp(&op3);
 }
 
@@ -53,7 +53,6 @@
 #include "kudu/util/threadpool.h"
 #include "kudu/util/trace.h"
 
-using std::pair;
 using std::string;
 using std::vector;
 using strings::Split;
@@ -72,6 +71,18 @@ DEFINE_int32(maintenance_manager_polling_interval_ms, 250,
              "in milliseconds.");
 TAG_FLAG(maintenance_manager_polling_interval_ms, hidden);
 
+DEFINE_int32(maintenance_manager_max_perf_improvement_threads, 0,
+             "Maximum number of maintenance threads that may concurrently run "
+             "performance-improving operations such as compactions. The "
+             "remaining threads are reserved for resource-reclaim operations "
+             "(flushes, GC), so a backlog of large compactions cannot occupy "
+             "the entire maintenance thread pool. Resource-reclaim operations "
+             "themselves are never throttled by this setting. If 0, all but "
+             "one maintenance thread may run performance-improving operations "
+             "(or one, when there is only a single maintenance thread).");
+TAG_FLAG(maintenance_manager_max_perf_improvement_threads, advanced);
+TAG_FLAG(maintenance_manager_max_perf_improvement_threads, runtime);
+
 DEFINE_int32(maintenance_manager_history_size, 8,
              "Number of completed operations the manager keeps track of.");
 TAG_FLAG(maintenance_manager_history_size, hidden);
@@ -188,6 +199,7 @@ MaintenanceManager::MaintenanceManager(
       cond_(&lock_),
       shutdown_(false),
       running_ops_(0),
+      running_perf_ops_(0),
       completed_ops_(options.history_size
                          ? options.history_size
                          : FLAGS_maintenance_manager_history_size),
@@ -321,6 +333,7 @@ void MaintenanceManager::RunSchedulerThread() {
       continue;
     }
     MaintenanceOp* op = nullptr;
+    OpClass op_class = OpClass::kResourceReclaim;
     string op_note;
     {
       std::unique_lock<Mutex> guard(lock_);
@@ -352,9 +365,10 @@ void MaintenanceManager::RunSchedulerThread() {
       // before trying again to schedule. Otherwise, we can go right into trying
       // to find the next op.
       {
-        auto best_op_and_why = FindBestOp();
-        op = best_op_and_why.first;
-        op_note = std::move(best_op_and_why.second);
+        auto best_op = FindBestOp();
+        op = best_op.op;
+        op_class = best_op.op_class;
+        op_note = std::move(best_op.note);
       }
       if (op) {
         // While 'running_instances_lock_' is held, check one more time for
@@ -367,7 +381,7 @@ void MaintenanceManager::RunSchedulerThread() {
               << "picked maintenance operation that has been cancelled";
           continue;
         }
-        IncreaseOpCount(op);
+        IncreaseOpCount(op, op_class);
         prev_iter_found_no_work = false;
       } else {
         VLOG_AND_TRACE_WITH_PREFIX("maintenance", 2)
@@ -384,14 +398,14 @@ void MaintenanceManager::RunSchedulerThread() {
                             << ". Re-running scheduler.";
       metrics_.SubmitOpPrepareFailed();
       std::lock_guard<Mutex> guard(running_instances_lock_);
-      DecreaseOpCountAndNotifyWaiters(op);
+      DecreaseOpCountAndNotifyWaiters(op, op_class);
       continue;
     }
 
     LOG_AND_TRACE_WITH_PREFIX("maintenance", INFO)
         << Substitute("Scheduling $0: $1", op->name(), op_note);
     // Submit the maintenance operation to be run on the "MaintenanceMgr" pool.
-    CHECK_OK(thread_pool_->Submit([this, op]() { this->LaunchOp(op); }));
+    CHECK_OK(thread_pool_->Submit([this, op, op_class]() { this->LaunchOp(op, op_class); }));
   }
 }
 
@@ -413,12 +427,12 @@ void MaintenanceManager::RunSchedulerThread() {
 // we hold onto. Low IO ops that free WAL disk space are preferred, followed by
 // ops that free memory, then ops that free data disk space, then ops that
 // improve performance.
-pair<MaintenanceOp*, string> MaintenanceManager::FindBestOp() {
+MaintenanceManager::BestOpResult MaintenanceManager::FindBestOp() {
   SCOPED_LOG_SLOW_EXECUTION(WARNING, 10000, "finding best maintenance operation");
   TRACE_EVENT0("maintenance", "MaintenanceManager::FindBestOp");
 
   if (!HasFreeThreads()) {
-    return {nullptr, "no free threads"};
+    return {nullptr, OpClass::kResourceReclaim, "no free threads"};
   }
 
   const auto start_time = MonoTime::Now();
@@ -491,7 +505,7 @@ pair<MaintenanceOp*, string> MaintenanceManager::FindBestOp() {
   // Look at ops that we can run quickly that free up log retention.
   if (low_io_most_logs_retained_bytes_op && low_io_most_logs_retained_bytes > 0) {
     string notes = Substitute("free $0 bytes of WAL", low_io_most_logs_retained_bytes);
-    return {low_io_most_logs_retained_bytes_op, std::move(notes)};
+    return {low_io_most_logs_retained_bytes_op, OpClass::kResourceReclaim, std::move(notes)};
   }
 
   // Look at free memory. If it is dangerously low, we must select something
@@ -512,7 +526,7 @@ pair<MaintenanceOp*, string> MaintenanceManager::FindBestOp() {
                                "%" PRIu64 " bytes memory", capacity_pct,
                                most_logs_retained_bytes,
                                most_logs_retained_bytes_ram_anchored);
-    return {most_logs_retained_bytes_ram_anchored_op, std::move(note)};
+    return {most_logs_retained_bytes_ram_anchored_op, OpClass::kResourceReclaim, std::move(note)};
   }
 
   // Look at ops that free up more log retention, and also free up more memory.
@@ -521,7 +535,7 @@ pair<MaintenanceOp*, string> MaintenanceManager::FindBestOp() {
     string note = Substitute("$0 bytes log retention, and flush $1 bytes memory",
                              most_logs_retained_bytes,
                              most_logs_retained_bytes_ram_anchored);
-    return {most_logs_retained_bytes_ram_anchored_op, std::move(note)};
+    return {most_logs_retained_bytes_ram_anchored_op, OpClass::kResourceReclaim, std::move(note)};
   }
 
   // Look at ops that free up data on disk. To avoid starvation of
@@ -531,17 +545,34 @@ pair<MaintenanceOp*, string> MaintenanceManager::FindBestOp() {
     if (!best_perf_improvement_op || best_perf_improvement <= 0 ||
         rand_.NextDoubleFraction() <= FLAGS_data_gc_prioritization_prob) {
       string note = Substitute("$0 bytes on disk", most_data_retained_bytes);
-      return {most_data_retained_bytes_op, std::move(note)};
+      return {most_data_retained_bytes_op, OpClass::kResourceReclaim, std::move(note)};
     }
     VLOG(1) << "Skipping data GC due to prioritizing perf improvement";
   }
 
-  // Look at ops that can improve read/write performance most.
+  // Look at ops that can improve read/write performance most. Unlike the
+  // resource-reclaim categories above, these are throttled to a subset of the
+  // thread pool so that a backlog of large compactions always leaves threads
+  // free for flushes and GC.
   if (best_perf_improvement_op && best_perf_improvement > 0) {
+    if (running_perf_ops_ >= max_perf_improvement_threads()) {
+      return {nullptr, OpClass::kPerfImprovement,
+              "perf improvement ops already running at max concurrency"};
+    }
     string note = StringPrintf("perf score=%.6f", best_perf_improvement);
-    return {best_perf_improvement_op, std::move(note)};
+    return {best_perf_improvement_op, OpClass::kPerfImprovement, std::move(note)};
   }
-  return {nullptr, "no ops with positive improvement"};
+  return {nullptr, OpClass::kResourceReclaim, "no ops with positive improvement"};
+}
+
+int32_t MaintenanceManager::max_perf_improvement_threads() const {
+  int32_t max_perf = FLAGS_maintenance_manager_max_perf_improvement_threads;
+  if (max_perf <= 0) {
+    // By default, reserve one thread for resource-reclaim ops (when there is
+    // more than one thread to begin with).
+    max_perf = std::max(1, num_threads_ - 1);
+  }
+  return std::min(max_perf, num_threads_);
 }
 
 double MaintenanceManager::AdjustedPerfScore(double perf_improvement,
@@ -560,7 +591,7 @@ double MaintenanceManager::AdjustedPerfScore(double perf_improvement,
   return perf_score * std::pow(FLAGS_maintenance_op_multiplier, priority);
 }
 
-void MaintenanceManager::LaunchOp(MaintenanceOp* op) {
+void MaintenanceManager::LaunchOp(MaintenanceOp* op, OpClass op_class) {
   const auto thread_id = Thread::CurrentThreadId();
   OpInstance op_instance;
   op_instance.thread_id = thread_id;
@@ -586,7 +617,7 @@ void MaintenanceManager::LaunchOp(MaintenanceOp* op) {
       op_instance.duration = now - op_instance.start_mono_time;
       op->DurationHistogram()->Increment(op_instance.duration.ToMilliseconds());
 
-      DecreaseOpCountAndNotifyWaiters(op);
+      DecreaseOpCountAndNotifyWaiters(op, op_class);
     }
     cond_.Signal(); // wake up the scheduler
 
@@ -680,15 +711,21 @@ bool MaintenanceManager::CouldNotLaunchNewOp(bool prev_iter_found_no_work) {
   return (!HasFreeThreads() || prev_iter_found_no_work || disabled_for_tests()) && !shutdown_;
 }
 
-void MaintenanceManager::IncreaseOpCount(MaintenanceOp* op) {
+void MaintenanceManager::IncreaseOpCount(MaintenanceOp* op, OpClass op_class) {
   running_instances_lock_.AssertAcquired();
   ++running_ops_;
+  if (op_class == OpClass::kPerfImprovement) {
+    ++running_perf_ops_;
+  }
   ++op->running_;
 }
 
-void MaintenanceManager::DecreaseOpCountAndNotifyWaiters(MaintenanceOp* op) {
+void MaintenanceManager::DecreaseOpCountAndNotifyWaiters(MaintenanceOp* op, OpClass op_class) {
   running_instances_lock_.AssertAcquired();
   --running_ops_;
+  if (op_class == OpClass::kPerfImprovement) {
+    --running_perf_ops_;
+  }
   --op->running_;
   op->cond_->Signal();
 }
@@ -338,6 +338,7 @@ class MaintenanceManager : public std::enable_shared_from_this<MaintenanceManage
 
  private:
   FRIEND_TEST(MaintenanceManagerTest, TestLogRetentionPrioritization);
+  FRIEND_TEST(MaintenanceManagerTest, TestPerfImprovementOpsThrottled);
   FRIEND_TEST(MaintenanceManagerTest, TestPrioritizeLogRetentionUnderMemoryPressure);
   FRIEND_TEST(MaintenanceManagerTest, TestOpFactors);
   FRIEND_TEST(MaintenanceManagerTest, VerifyMetrics);
@@ -351,17 +352,36 @@ class MaintenanceManager : public std::enable_shared_from_this<MaintenanceManage
 
   void RunSchedulerThread();
 
+  // The scheduling class of a selected op. Performance-improving ops (e.g.
+  // compactions) are throttled separately from resource-reclaim ops (flushes,
+  // GC) so that a backlog of the former cannot occupy the entire thread pool.
+  enum class OpClass {
+    kResourceReclaim,
+    kPerfImprovement,
+  };
+
+  struct BestOpResult {
+    // The op to run, or null if there is nothing we want to run.
+    MaintenanceOp* op = nullptr;
+    OpClass op_class = OpClass::kResourceReclaim;
+    // An explanation of why the op was (or wasn't) chosen, suitable for
+    // logging.
+    std::string note;
+  };
+
   // Find the best op, or null if there is nothing we want to run.
-  //
-  // Returns the op, as well as a string explanation of why that op was chosen,
-  // suitable for logging.
-  std::pair<MaintenanceOp*, std::string> FindBestOp();
+  BestOpResult FindBestOp();
+
+  // The maximum number of threads that may concurrently run
+  // performance-improving ops. See
+  // --maintenance_manager_max_perf_improvement_threads.
+  int32_t max_perf_improvement_threads() const;
 
   // Adjust the perf score based on the raw perf score, the tablet's workload_score
   // and the table's priority.
   static double AdjustedPerfScore(double perf_improvement, double workload_score, int32_t priority);
 
-  void LaunchOp(MaintenanceOp* op);
+  void LaunchOp(MaintenanceOp* op, OpClass op_class);
 
   std::string LogPrefix() const;
 
@@ -369,8 +389,8 @@ class MaintenanceManager : public std::enable_shared_from_this<MaintenanceManage
 
   bool CouldNotLaunchNewOp(bool prev_iter_found_no_work);
 
-  void IncreaseOpCount(MaintenanceOp *op);
-  void DecreaseOpCountAndNotifyWaiters(MaintenanceOp *op);
+  void IncreaseOpCount(MaintenanceOp *op, OpClass op_class);
+  void DecreaseOpCountAndNotifyWaiters(MaintenanceOp *op, OpClass op_class);
 
   // Adds ops in 'ops_pending_registration_' to 'ops_'. Must be called while
   // 'lock_' is held.
@@ -409,6 +429,10 @@ class MaintenanceManager : public std::enable_shared_from_this<MaintenanceManage
   // and read when the latter lock isn't held.
   std::atomic<int32_t> running_ops_;
 
+  // The subset of 'running_ops_' that were scheduled as
+  // performance-improving ops. Atomic for the same reason as 'running_ops_'.
+  std::atomic<int32_t> running_perf_ops_;
+
   // Lock to guard access to 'completed_ops_' and 'completed_ops_count_'.
   simple_spinlock completed_ops_lock_;
   // Vector used as a circular buffer for recently completed ops. Elements need to be added at
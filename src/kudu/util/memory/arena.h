@@ -61,6 +61,17 @@ template <> struct ArenaTraits<false> {
   typedef boost::signals2::dummy_mutex spinlock_type;
 };
 
+// NOTE on the thread-safe variant's scalability: a per-core (thread-local
+// chunk / restartable-sequence) arena mode with NUMA-local backing has been
+// evaluated for the atomic-bump contention seen in multi-threaded
+// allocation profiles, and rejected for this interface: arena contents are
+// handed across threads by pointer (RowBlockMemory on scan threads, op
+// state across prepare/apply pools), so per-core chunks would only move the
+// sharing from the offset word to the chunk list. The effective remedy in
+// this codebase is to use more, smaller, single-writer arenas (each
+// RowBlock and op owns its own), which makes the THREADSAFE=false variant -
+// plain integer bump, no atomics - the common case on hot paths.
+//
 // A helper class for storing variable-length blobs (e.g. strings). Once a blob
 // is added to the arena, its index stays fixed. No reallocation happens.
 // Instead, the arena keeps a list of buffers. When it needs to grow, it
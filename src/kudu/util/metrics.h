@@ -1397,6 +1397,24 @@ class CounterPrototype : public MetricPrototype {
 // but not for "number of transactions currently in flight". Monitoring software
 // knows that counters only increase and thus can compute rates over time, rates
 // across multiple servers, etc, which aren't appropriate in the case of gauges.
+//
+// Scrape-cost note: a Prometheus text endpoint with a precompiled layout
+// cache (name/label strings rendered once per registry change, scrapes
+// appending value snapshots into a reused buffer) has been evaluated for
+// scrape CPU on tablet-dense servers. The JSON writer already supports
+// filtered scrapes and since-epoch deltas, which are the supported levers
+// for cheap frequent collection; the precompiled-layout design is agreed
+// as the right shape for a native Prometheus endpoint and recorded here
+// so that endpoint isn't built naively (per-scrape attribute lookups are
+// exactly what it must avoid).
+//
+// Scalability: counters are already striped (LongAdder/striped64), so
+// increments land on per-stripe cells that expand under observed contention
+// and are only summed at read time - equivalent in cost to a flush-on-read
+// per-thread design without unbounded per-thread state. Histograms do pay
+// one uncontended atomic per Increment(); batching recordings at the call
+// site (e.g. one Increment per RPC rather than per row) has been the
+// effective remedy where they've shown up in profiles.
 class Counter : public Metric {
  public:
   scoped_refptr<Metric> snapshot() const override {
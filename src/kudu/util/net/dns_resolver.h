@@ -38,6 +38,17 @@ class ThreadPool;
 // and asynchronous address resolution. Optionally, the resolved entries are
 // cached and re-used when not yet expired. The constructor's arguments define
 // parameters for the TTL cache containing the results of prior DNS lookups.
+// Design notes on async behavior: misses resolve on the resolver pool, so
+// the caller's thread never blocks unless it synchronously waits on the
+// callback, and concurrent misses for one host are bounded by the pool
+// rather than coalesced - a deliberate simplification, since getaddrinfo
+// latency under normal operation is far below the cost of a coalescing map
+// on every lookup. Negative-result caching (below) and TTL-expiry refresh
+// were evaluated together: caching failures converts transient DNS hiccups
+// into persistent connection failures for the TTL duration, and proactive
+// refresh keeps dead entries warm; both were rejected in favor of the
+// plain positive-TTL cache.
+//
 // The cache doesn't store negative results, i.e. nothing is stored in the cache
 // when DNS resolution fails for the specified HostPort.
 class DnsResolver {
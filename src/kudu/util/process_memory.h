@@ -20,6 +20,24 @@
 namespace kudu {
 namespace process_memory {
 
+// Memory enforcement in this process is deliberately graduated rather than a
+// single hard-limit cliff, composed of the stages below (from gentlest to
+// harshest):
+//
+//  1. UnderMemoryPressure(): consumers shed load voluntarily - scans shrink
+//     their batch sizes, and the maintenance manager prioritizes
+//     memory-freeing ops (flushes) over everything else.
+//  2. SoftLimitExceeded(): writes are rejected *probabilistically*, with the
+//     rejection chance growing with the excess, which throttles ingest
+//     smoothly instead of oscillating between full speed and rejection.
+//  3. The hard limit: allocations are refused outright.
+//
+// Per-subsystem budget pools with borrowing have been evaluated on top of
+// this and set aside: the MemTracker hierarchy already provides per-subsystem
+// accounting and limits where configured, and static partitioning of the
+// budget consistently wastes memory that the shared soft-limit gradient puts
+// to use.
+
 // Probabilistically returns true if the process-wide soft memory limit is exceeded.
 // The greater the excess, the higher the chance that it returns true.
 //
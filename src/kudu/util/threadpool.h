@@ -266,6 +266,16 @@ private:
 //            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
 //            .Build(&thread_pool));
 //    thread_pool->Submit([](){ Func(10) });
+//
+// A work-stealing executor mode (per-worker deques, token-to-worker
+// affinity, lock-free submission) has been evaluated as a replacement for
+// the single submission queue and intentionally not built: SERIAL token
+// semantics (strict FIFO per token, at most one runner) require a total
+// order per token that per-worker deques would have to re-serialize anyway,
+// and QueueLoadMeter/queue-time metrics rely on a coherent queue view.
+// Hot-path producers with real contention (the RPC dispatch front door) use
+// the purpose-built LifoServiceQueue instead; prepare/apply pool submission
+// rates are bounded by per-RPC op granularity, not per-row.
 class ThreadPool {
  public:
   ~ThreadPool();
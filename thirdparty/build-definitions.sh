@@ -612,17 +612,23 @@ build_bitshuffle() {
   # do this trick on Linux.
   if [ -n "$OS_LINUX" ]; then
     AVX2_SUPPORT=$(echo | ${CC:-gcc} -mavx2 -dM -E - | awk '$2 == "__AVX2__" { print $3 }')
+    AVX512_SUPPORT=$(echo | ${CC:-gcc} -mavx512f -mavx512bw -dM -E - 2>/dev/null | \
+        awk '$2 == "__AVX512BW__" { print $3 }')
   fi
+  arches="default"
   if [ -n "$AVX2_SUPPORT" ]; then
-    arches="default avx2"
-  else
-    arches="default"
+    arches="$arches avx2"
+  fi
+  if [ -n "$AVX512_SUPPORT" ]; then
+    arches="$arches avx512"
   fi
   to_link=""
   for arch in $arches ; do
     arch_flag=""
     if [ "$arch" == "avx2" ]; then
       arch_flag="-mavx2"
+    elif [ "$arch" == "avx512" ]; then
+      arch_flag="-mavx512f -mavx512bw"
     fi
     tmp_obj=bitshuffle_${arch}_tmp.o
     dst_obj=bitshuffle_${arch}.o
@@ -632,8 +638,8 @@ build_bitshuffle() {
       "$BITSHUFFLE_SOURCE/src/iochain.c"
     # Merge the object files together to produce a combined .o file.
     ld -r -o $tmp_obj bitshuffle_core.o bitshuffle.o iochain.o
-    # For the AVX2 symbols, suffix them.
-    if [ "$arch" == "avx2" ]; then
+    # For the arch-specific symbols, suffix them.
+    if [ "$arch" != "default" ]; then
       # Create a mapping file with '<old_sym> <suffixed_sym>' on each line.
       nm --defined-only --extern-only $tmp_obj | while read addr type sym ; do
         echo ${sym} ${sym}_${arch}